@@ -2,16 +2,152 @@
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <limits.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 typedef struct Type Type;
 typedef struct Member Member;
 
+//
+// arena.c
+//
+
+typedef struct ArenaBlock ArenaBlock;
+
+// バンプポインタ方式のアロケータ．確保したメモリは個別には解放せず，
+// アリーナごとまとめて解放する
+typedef struct Arena Arena;
+struct Arena {
+    char *name;          // 統計表示用の名前
+    ArenaBlock *blocks;
+    Arena *next;
+    bool registered;
+
+    // 統計
+    long nalloc;         // 確保回数
+    long used;           // 確保したバイト数
+    long reserved;       // malloc したブロックの合計バイト数
+};
+
+void arena_register(Arena *arena);
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strndup(Arena *arena, char *s, int len);
+void arena_release(Arena *arena);
+void arena_release_all();
+
+//
+// hashmap.c
+//
+
+typedef struct {
+    char *key;
+    int keylen;
+    void *val;
+} HashEntry;
+
+typedef struct {
+    HashEntry *buckets;
+    int capacity;
+    int used;
+    Arena *arena;   // バケットの確保先．NULL なら malloc する
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
+int intern_id(char *s, int len);
+char *intern(char *s, int len);
+
+//
+// output.c
+//
+
+// 出力先．ファイルに書く時は buf が一杯になるたびに write(2) し，
+// メモリに出す時 (fd < 0) は buf を広げながら全部を溜めておく
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t cap;
+    int fd;
+    char *path;
+    long total;        // 書き出し済みのバイト数
+
+    // out_capture_begin() 以降に出力したものの写し．buf から溢れた分
+    // だけをここに移す
+    bool capturing;
+    size_t capstart;   // buf の中での写しの始まり
+    char *capbuf;
+    size_t caplen;
+    size_t capcap;
+} Output;
+
+void out_open(char *path);
+void out_open_mem();
+void out_write(void *p, size_t len);
+void out_char(int c);
+void out_str(char *s);
+void out_int(long val);
+void out_flush();
+void out_close();
+long out_bytes();
+void out_capture_begin();
+char *out_capture_end(int *len);
+
+//
+// stats.c
+//
+
+// peephole.c の規則の数
+#define NUM_PEEPHOLE_RULES 3
+
+// コンパイル中に作ったものの数
+typedef struct {
+    long tokens;
+    long nodes;
+    long types;
+    long vars;
+    long cache_hits;
+    long cache_misses;
+    long peephole[NUM_PEEPHOLE_RULES];   // 規則ごとの書き換えの回数
+} Counts;
+
+// --stats で計るフェーズ
+typedef struct {
+    char *name;
+    double wall;   // 秒
+    double cpu;    // 秒 (全スレッドの合計)
+    long alloc;    // ヒープの使用量の増分 (バイト)
+} Phase;
+
+#define MAX_PHASES 16
+
+typedef struct {
+    bool enabled;
+    Phase phases[MAX_PHASES];
+    int nphases;
+    Phase *cur;    // 計測中のフェーズ
+} Stats;
+
+void stats_enable();
+void stats_phase(char *name);
+void print_stats(FILE *fp, bool json);
+
+//
+// scan.c
+//
+void scan_init(char *name);
+extern char *(*skip_space)(char *p);
+extern char *(*skip_ident)(char *p);
+extern char *(*find_byte2)(char *p, char a, char b);
+
 //
 // tokenize.c
 //
@@ -25,37 +161,58 @@ typedef enum {
     TK_EOF,      // 入力の終わりを表すトークン
 } TokenKind;
 
-// トークン型
-typedef struct Token Token;
-struct Token {
-    TokenKind kind; // トークンの型
-    Token *next;    // 次の入力トークン
-    int val;        // kindがTK_NUMの場合，その数値
-    char *str;      // トークン文字列
-    int len;        // トークンの長さ
-
-    char *contents; // 終端NULL('\0')を含む文字列リテラルのコンテンツ
-    char cont_len;  // 文字列リテラルの長さ
-};
+// トークン．トークン列 tokens の中の番号で表す．番号 0 は使わないので，
+// 「トークンなし」を 0 で表せる
+typedef int Token;
+
+// 文字列リテラルの中身の TokenArray::strbuf の中での位置
+typedef struct {
+    int offset;
+    int len;        // 終端の '\0' を含む長さ
+} StrLit;
+
+// トークン列．トークンごとの構造体ではなくフィールドごとの配列で持つので
+// 1トークンあたり13バイトで済み，先読みや後戻りは番号を変えるだけでできる．
+// 位置と長さは32ビットなので，入力は4GiB未満でなければならない (tokenize()
+// が調べる)
+typedef struct {
+    unsigned char *kind; // TokenKind
+    uint32_t *loc;       // user_input の先頭からのオフセット
+    uint32_t *len;       // トークンの長さ
+    int *val;            // TK_NUM なら数値，TK_STR なら strs の添字，
+                         // TK_IDENT と TK_RESERVED なら atom の番号
+    int size;
+    int capacity;
+
+    // 文字列リテラルの中身はここにまとめて置く
+    StrLit *strs;
+    int nstrs;
+    int strs_capacity;
+    char *strbuf;
+    int strbuf_len;
+    int strbuf_capacity;
+} TokenArray;
+
+#define unreachable() \
+    error("internal error at %s:%d", __FILE__, __LINE__)
 
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
-void error_tok(Token *tok, char *fmt, ...);
-Token *peek(char *s);
-Token *consume(char *op);
-Token *consume_ident();
+void error_tok(Token tok, char *fmt, ...);
+char *tok_str(Token tok);
+char *tok_atom(Token tok);
+char *tok_contents(Token tok);
+int tok_cont_len(Token tok);
+Token peek(char *s);
+Token consume(char *op);
+Token consume_ident();
 void expect(char *op);
 long expect_number();
 char *expect_ident();
 bool at_eof();
-Token *tokenize();
-
-
-extern char *filename;
-extern Token *token;
-extern char *user_input;
-
-
+Token tokenize();
+void free_tokens(TokenArray *ts);
+void dump_tokens(Token tok);
 
 //
 // parse.c
@@ -64,7 +221,7 @@ extern char *user_input;
 // 変数
 typedef struct Var Var;
 struct Var {
-    char *name;    // 変数の名前
+    char *name;    // 変数の名前 (ローカル変数では intern() されている)
     Type *ty;      // Type
     bool is_local; // Local変数かGlobal変数か
 
@@ -91,6 +248,7 @@ typedef enum {
     ND_PTR_DIFF,  // ptr - ptr
     ND_MUL,       // *
     ND_DIV,       // /
+    ND_SHL,       // << (x * 2^n の畳み込み結果)
     ND_EQ,        // ==
     ND_NE,        // !=
     ND_LT,        // <
@@ -117,7 +275,7 @@ struct Node {
     NodeKind kind; // ノードの型
     Node *next;    // 次のノード
     Type *ty;      // Type Ex) int or point to int
-    Token *tok;    // トークン
+    Token tok;     // トークン
 
     Node *lhs;     // 左辺
     Node *rhs;     // 右辺
@@ -152,6 +310,16 @@ struct Function {
     Node *node;
     VarList *locals;
     int stack_size;
+
+    Arena arena;   // この関数のASTノード
+
+    // 関数定義のトークンの範囲 [tok_begin, tok_end)
+    Token tok_begin;
+    Token tok_end;
+
+    // 出力のキャッシュ (cache.c)
+    char *cache_key;   // キャッシュファイルの名前．NULL ならキャッシュしない
+    char *cached;      // キャッシュにあったアセンブリ
 };
 
 typedef struct {
@@ -161,6 +329,80 @@ typedef struct {
 
 Program *program();
 
+//
+// context.c
+//
+
+typedef struct Scope Scope;
+
+// エラー．位置の分からないエラーでは line と column が 0
+typedef struct {
+    char *filename;
+    int line;
+    int column;       // 1 から数えたバイト単位の桁
+    char *message;
+} Diagnostic;
+
+// 1つの翻訳単位をコンパイルする間の状態．コンパイラの各部分は，今の
+// スレッドの ctx が指すものを使う．context_reset() で次のコンパイルに
+// 使い回せる
+typedef struct CompileContext CompileContext;
+struct CompileContext {
+    // オプション．context_new() が既定値を入れ，context_reset() では変わらない
+    int opt_level;       // 1以上でインライン展開とのぞき穴最適化をする
+    bool opt_regalloc;
+    int opt_jobs;        // コード生成と字句解析に使うスレッドの数
+    bool opt_inline_report;
+    int lex_chunk_size;  // 並列に字句解析する時の1チャンクの最小のバイト数
+    char *cache_dir;     // 関数ごとのアセンブリのキャッシュ (NULL ならしない)
+
+    // 入力 (tokenize.c)
+    char *filename;
+    char *user_input;
+    TokenArray tokens;
+    Token token;         // 今読んでいるトークン
+
+    // atom (hashmap.c)
+    HashMap atom_map;    // 綴り -> 番号 + 1
+    char **atoms;        // 番号 -> 綴り
+    int natoms;
+    int atoms_capacity;
+    Arena atom_arena;
+
+    // パーサ (parse.c)
+    VarList *locals;     // 今パースしている関数のローカル変数
+    VarList *globals;
+    Scope *scope;
+    HashMap var_map;     // 変数名 -> 今見えている VarScope
+    int nlabels;         // 文字列リテラルのラベルの数
+    Arena parse_arena;   // 関数をまたいで使われるもの
+    Arena *node_arena;   // 今パースしている関数のノード用
+    Arena type_arena;
+
+    // 使用中の全アリーナ (arena.c)
+    Arena *arenas;
+    Arena **arenas_last;
+
+    Output output;
+    Counts counts;
+    Stats stats;
+
+    // compile() の中では，エラーは表示して終了する代わりに diags に
+    // 記録して bailout に戻る
+    jmp_buf *bailout;
+    Diagnostic *diags;
+    int ndiags;
+
+    char *srcbuf;        // compile() に渡されたソースのコピー
+};
+
+extern _Thread_local CompileContext *ctx;
+
+CompileContext *context_new();
+void context_reset(CompileContext *c);
+void context_free(CompileContext *c);
+int compile(CompileContext *c, char *filename, char *src, size_t len);
+
 //
 //typing.c
 //
@@ -178,13 +420,14 @@ struct Type {
     Type   *base;     // pointer or array
     size_t array_len; // 配列の時に使う
     Member *members;  // struct
+    HashMap *member_map; // メンバが多い struct のメンバ名 -> Member
 };
 
 // Struct member
 struct Member {
     Member *next;
     Type *ty;
-    char *name;
+    char *name;     // intern() された名前
     int offset;
 };
 
@@ -192,11 +435,263 @@ extern Type *char_type;
 extern Type *int_type;
 
 bool is_integer(Type *ty);
+Type *new_type(TypeKind kind, int size);
 Type *pointer_to(Type *base);
 Type *array_of(Type *base, int size);
 void add_type(Node *node);
 
+//
+// fold.c
+//
+void fold(Program *prog);
+
+//
+// inline.c
+//
+void inline_functions(Program *prog);
+
+//
+// ir.c
+//
+
+// 三番地コードの命令
+typedef enum {
+    IR_IMM,       // dst = imm
+    IR_ADDR,      // dst = &var
+    IR_ADD,       // dst = a + b
+    IR_SUB,       // dst = a - b
+    IR_MUL,       // dst = a * b
+    IR_DIV,       // dst = a / b
+    IR_SHL,       // dst = a << b
+    IR_EQ,        // dst = a == b
+    IR_NE,        // dst = a != b
+    IR_LT,        // dst = a < b
+    IR_LE,        // dst = a <= b
+    IR_LOAD,      // dst = *a
+    IR_STORE,     // *a = b
+    IR_STORE_ARG, // var = imm番目の引数
+    IR_CALL,      // dst = name(args...)
+    IR_BR,        // a != 0 なら then へ，そうでなければ els へ
+    IR_JMP,       // then へ
+    IR_RET,       // return a
+} IROp;
+
+// レジスタで渡せる引数の数．これより多い呼び出しはエラーにする
+#define MAX_ARGS 6
+
+typedef struct BB BB;
+
+typedef struct IR IR;
+struct IR {
+    IROp op;
+    IR *next;
+
+    int dst;      // 結果を書き込む仮想レジスタ (0 なら無し)
+    int a;
+    int b;
+    long imm;
+    int size;     // load/store のバイト数
+    Var *var;     // IR_ADDR, IR_STORE_ARG
+
+    // IR_CALL
+    char *name;
+    int args[MAX_ARGS];
+    int nargs;
+
+    // IR_BR, IR_JMP
+    BB *then;
+    BB *els;
+};
+
+// 基本ブロック
+struct BB {
+    BB *next;
+    int label;
+    IR *ir;
+    IR *last;
+};
+
+typedef struct IRFunc IRFunc;
+struct IRFunc {
+    IRFunc *next;
+    char *name;
+    VarList *params;
+    BB *bbs;
+    int nbb;
+    int nreg;     // 使用した仮想レジスタの数
+};
+
+IRFunc *gen_ir_func(Function *fn);
+IRFunc *gen_ir(Program *prog);
+void dump_ir(IRFunc *fns);
+
 //
 // codegen.c
 //
-void codegen(Program *prog);
+
+// x86-64 の汎用レジスタ．値は命令エンコーディングでのレジスタ番号
+typedef enum {
+    RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+    R8, R9, R10, R11, R12, R13, R14, R15,
+} Reg;
+
+// 条件コード．値は Jcc/SETcc のエンコーディング下位4ビット
+typedef enum {
+    CC_E = 0x4,
+    CC_NE = 0x5,
+    CC_L = 0xc,
+    CC_GE = 0xd,
+    CC_LE = 0xe,
+    CC_G = 0xf,
+} CondCode;
+
+typedef enum {
+    OPD_NONE,
+    OPD_REG,   // レジスタ
+    OPD_IMM,   // 即値
+    OPD_MEM,   // [reg+disp]
+    OPD_SYM,   // offset sym (シンボルのアドレス)
+    OPD_LABEL, // ジャンプ先・呼び出し先のラベル
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    Reg reg;     // OPD_REG, またはOPD_MEMのベースレジスタ
+    int size;    // OPD_REG と OPD_MEM のバイト数 (1 or 8)
+    long imm;    // OPD_IMM の値, またはOPD_MEMのディスプレースメント
+    char *name;  // OPD_SYM と OPD_LABEL のシンボル名
+} Operand;
+
+typedef enum {
+    I_LABEL,   // name:
+    I_MOV,
+    I_MOVSX,
+    I_MOVZX,
+    I_LEA,
+    I_PUSH,
+    I_POP,
+    I_ADD,
+    I_SUB,
+    I_IMUL,
+    I_AND,
+    I_SHL,
+    I_CMP,
+    I_CQO,
+    I_IDIV,
+    I_SET,     // setcc
+    I_JMP,
+    I_JCC,     // jcc
+    I_CALL,
+    I_RET,
+    I_TEXT,    // キャッシュにあった関数のアセンブリ
+} InsnKind;
+
+// コード生成結果の命令列
+typedef struct Insn Insn;
+struct Insn {
+    Insn *next;
+    InsnKind kind;
+    Operand dst;
+    Operand src;
+    CondCode cc;   // I_SET, I_JCC
+    bool global;   // I_LABEL が .global なシンボルかどうか
+    char *text;    // I_TEXT
+};
+
+int align_to(int n, int align);
+void assign_lvar_offsets(Program *prog);
+CondCode negate_cc(CondCode cc);
+Insn *codegen(Program *prog);
+
+//
+// regalloc.c
+//
+
+// IR の仮想レジスタの置き場所
+typedef enum {
+    LOC_NONE,   // regalloc() が決める
+    LOC_REG,    // 物理レジスタ
+    LOC_STACK,  // フレーム上のスロット [rbp-offset]
+    LOC_IMM,    // 定数．使うところに即値として埋める
+    LOC_LVAR,   // ローカル変数のアドレス rbp-offset．使うところで計算する
+    LOC_FLAGS,  // 直後の分岐だけが使う比較の結果．フラグにしか置かない
+} LocKind;
+
+typedef struct {
+    LocKind kind;
+    Reg reg;      // LOC_REG
+    int offset;   // LOC_STACK, LOC_LVAR
+    long imm;     // LOC_IMM
+} Loc;
+
+// regalloc() が使う callee-saved レジスタ．使った分だけ先頭から退避する
+#define NUM_CALLEE_SAVED 5
+extern Reg callee_saved[NUM_CALLEE_SAVED];
+
+int regalloc(IRFunc *f, Loc *locs, bool *reachable, int offset, int *nsaved);
+
+//
+// peephole.c
+//
+Insn *peephole(Insn *insns);
+void print_peephole_stats(FILE *fp, bool json);
+
+//
+// cache.c
+//
+void cache_lookup(Program *prog);
+void cache_begin(Function *fn);
+void cache_end(Function *fn);
+
+//
+// asm.c
+//
+void emit_asm(Program *prog, Insn *insns);
+
+//
+// x86.c
+//
+
+// 再配置の種類
+typedef enum {
+    R_PC32,   // 呼び出し先の32bit PC相対アドレス (call)
+    R_ABS32S, // 符号拡張される32bit絶対アドレス (offset sym)
+} RelocKind;
+
+typedef struct Reloc Reloc;
+struct Reloc {
+    Reloc *next;
+    RelocKind kind;
+    int offset;  // 書き換える位置 (.text 先頭からのオフセット)
+    char *name;  // 参照先シンボル
+};
+
+// .text で定義されたシンボル
+typedef struct TextSym TextSym;
+struct TextSym {
+    TextSym *next;
+    char *name;
+    int offset;
+    int size;
+};
+
+typedef struct {
+    unsigned char *buf;
+    int len;
+    int cap;
+    Reloc *relocs;   // このコード内で解決できなかった参照
+    TextSym *syms;   // .global な関数
+} MachineCode;
+
+MachineCode *encode(Insn *insns);
+unsigned char *layout_data(Program *prog, int *size, HashMap *vars);
+
+//
+// jit.c
+//
+int run_jit(Program *prog, MachineCode *mc);
+
+//
+// elf.c
+//
+void emit_elf(Program *prog, MachineCode *mc);
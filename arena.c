@@ -0,0 +1,124 @@
+#include "9cc.h"
+
+// ブロックは MIN_BLOCK_SIZE から倍々に MAX_BLOCK_SIZE まで大きくしていく．
+// 関数ごとのアリーナのように小さなものが大量にあっても無駄が少ない
+#define MIN_BLOCK_SIZE (1024)
+#define MAX_BLOCK_SIZE (64 * 1024)
+
+struct ArenaBlock {
+    ArenaBlock *next;
+    char *ptr;
+    char *end;
+    char data[];
+};
+
+static ArenaBlock *new_block(Arena *arena, size_t size) {
+    ArenaBlock *blk = calloc(1, sizeof(ArenaBlock) + size);
+    if (!blk)
+        error("out of memory");
+    blk->ptr = blk->data;
+    blk->end = blk->data + size;
+    arena->reserved += size;
+    return blk;
+}
+
+// Adds the arena to the context's list of arenas, which are released
+// together by arena_release_all(). arena_alloc() does this on the first
+// allocation; arenas that other threads allocate from must be registered
+// beforehand, because the list is not thread-safe.
+void arena_register(Arena *arena) {
+    if (arena->registered)
+        return;
+    arena->registered = true;
+    arena->next = NULL;
+    *ctx->arenas_last = arena;
+    ctx->arenas_last = &arena->next;
+}
+
+// Returns zero-initialized memory that lives until the arena is released.
+void *arena_alloc(Arena *arena, size_t size) {
+    size = (size + 7) & ~(size_t)7;
+    arena_register(arena);
+
+    arena->nalloc++;
+    arena->used += size;
+
+    ArenaBlock *blk = arena->blocks;
+    if (blk && blk->end - blk->ptr >= size) {
+        void *p = blk->ptr;
+        blk->ptr += size;
+        return p;
+    }
+
+    // 大きな要求は専用ブロックにして，今のブロックの残りを無駄にしない
+    if (size > MAX_BLOCK_SIZE / 4) {
+        ArenaBlock *big = new_block(arena, size);
+        big->ptr = big->end;
+        if (blk) {
+            big->next = blk->next;
+            blk->next = big;
+        } else {
+            arena->blocks = big;
+        }
+        return big->data;
+    }
+
+    size_t blksz = blk ? (blk->end - blk->data) * 2 : MIN_BLOCK_SIZE;
+    if (blksz > MAX_BLOCK_SIZE)
+        blksz = MAX_BLOCK_SIZE;
+    while (blksz < size)
+        blksz *= 2;
+
+    blk = new_block(arena, blksz);
+    blk->next = arena->blocks;
+    arena->blocks = blk;
+
+    void *p = blk->ptr;
+    blk->ptr += size;
+    return p;
+}
+
+char *arena_strndup(Arena *arena, char *s, int len) {
+    char *p = arena_alloc(arena, len + 1);
+    memcpy(p, s, len);
+    return p;
+}
+
+// Frees every block of the arena. Statistics are kept.
+void arena_release(Arena *arena) {
+    ArenaBlock *blk = arena->blocks;
+    while (blk) {
+        ArenaBlock *next = blk->next;
+        free(blk);
+        blk = next;
+    }
+    arena->blocks = NULL;
+}
+
+// Releases all memory of the compilation unit at once. Statistics are
+// reset, and the arenas can be used again.
+void arena_release_all() {
+    // 関数のアリーナは parse のアリーナの中にあるので，ブロックを全部
+    // つなぎ替えてから解放する
+    ArenaBlock *all = NULL;
+    for (Arena *a = ctx->arenas; a; a = a->next) {
+        ArenaBlock *blk = a->blocks;
+        while (blk) {
+            ArenaBlock *next = blk->next;
+            blk->next = all;
+            all = blk;
+            blk = next;
+        }
+        a->blocks = NULL;
+        a->registered = false;
+        a->nalloc = a->used = a->reserved = 0;
+    }
+
+    while (all) {
+        ArenaBlock *next = all->next;
+        free(all);
+        all = next;
+    }
+    ctx->arenas = NULL;
+    ctx->arenas_last = &ctx->arenas;
+}
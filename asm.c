@@ -0,0 +1,193 @@
+#include "9cc.h"
+
+static char *reg64[] = {
+    "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+
+static char *reg8[] = {
+    "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+    "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b",
+};
+
+static char *mnemonic[] = {
+    [I_MOV] = "mov", [I_MOVSX] = "movsx", [I_MOVZX] = "movzb",
+    [I_LEA] = "lea", [I_PUSH] = "push", [I_POP] = "pop",
+    [I_ADD] = "add", [I_SUB] = "sub", [I_IMUL] = "imul", [I_AND] = "and",
+    [I_SHL] = "shl", [I_CMP] = "cmp", [I_CQO] = "cqo", [I_IDIV] = "idiv",
+    [I_JMP] = "jmp", [I_CALL] = "call", [I_RET] = "ret",
+};
+
+static char *cc_name(CondCode cc) {
+    switch (cc) {
+        case CC_E: return "e";
+        case CC_NE: return "ne";
+        case CC_L: return "l";
+        case CC_GE: return "ge";
+        case CC_LE: return "le";
+        case CC_G: return "g";
+    }
+    return NULL;
+}
+
+static void print_operand(Insn *insn, Operand *opd) {
+    switch (opd->kind) {
+        case OPD_REG:
+            out_str(opd->size == 1 ? reg8[opd->reg] : reg64[opd->reg]);
+            return;
+        case OPD_IMM:
+            out_int(opd->imm);
+            return;
+        case OPD_MEM:
+            // 符号・ゼロ拡張ではレジスタからメモリの大きさが分からない
+            if (insn->kind == I_MOVSX || insn->kind == I_MOVZX)
+                out_str(opd->size == 1 ? "byte ptr " : "qword ptr ");
+            out_char('[');
+            out_str(reg64[opd->reg]);
+            if (opd->imm > 0)
+                out_char('+');
+            if (opd->imm != 0)
+                out_int(opd->imm);
+            out_char(']');
+            return;
+        case OPD_SYM:
+            out_str("offset ");
+            out_str(opd->name);
+            return;
+        case OPD_LABEL:
+            out_str(opd->name);
+            return;
+    }
+}
+
+static void print_insn(Insn *insn) {
+    if (insn->kind == I_TEXT) {
+        out_str(insn->text);
+        return;
+    }
+
+    if (insn->kind == I_LABEL) {
+        if (insn->global) {
+            out_str(".global ");
+            out_str(insn->dst.name);
+            out_char('\n');
+        }
+        out_str(insn->dst.name);
+        out_str(":\n");
+        return;
+    }
+
+    if (insn->kind == I_SET) {
+        out_str("  set");
+        out_str(cc_name(insn->cc));
+    } else if (insn->kind == I_JCC) {
+        // 飛び先のラベルの桁をそろえる
+        char *cc = cc_name(insn->cc);
+        out_str("  j");
+        out_str(cc);
+        if (!cc[1])
+            out_char(' ');
+    } else {
+        out_str("  ");
+        out_str(mnemonic[insn->kind]);
+    }
+
+    if (insn->dst.kind != OPD_NONE) {
+        out_char(' ');
+        print_operand(insn, &insn->dst);
+    }
+    if (insn->src.kind != OPD_NONE) {
+        out_str(", ");
+        print_operand(insn, &insn->src);
+    }
+    out_char('\n');
+}
+
+// 文字列データは1行にこのバイト数ずつ出力する
+#define DATA_LINE_LEN 64
+
+// Prints bytes as the body of an assembler string literal.
+static void print_quoted(char *s, int len) {
+    out_char('"');
+    for (int i = 0; i < len; i++) {
+        unsigned char c = s[i];
+
+        // そのまま出せる文字の並びはまとめて書き出す
+        int j = i;
+        while (j < len && isprint((unsigned char)s[j]) && s[j] != '"' && s[j] != '\\')
+            j++;
+        if (j > i) {
+            out_write(s + i, j - i);
+            i = j - 1;
+            continue;
+        }
+
+        if (c == '"' || c == '\\') {
+            out_char('\\');
+            out_char(c);
+        } else {
+            // 続く文字が数字でも紛れないよう常に3桁の8進数にする
+            out_char('\\');
+            out_char('0' + (c >> 6));
+            out_char('0' + ((c >> 3) & 7));
+            out_char('0' + (c & 7));
+        }
+    }
+    out_char('"');
+}
+
+static void emit_data(Program *prog) {
+    out_str(".data\n");
+
+    for (VarList *vl = prog->globals; vl; vl = vl->next) {
+        Var *var = vl->var;
+        out_str(var->name);
+        out_str(":\n");
+
+        if (!var->contents) {
+            out_str("  .zero ");
+            out_int(var->ty->size);
+            out_char('\n');
+            continue;
+        }
+
+        // 長いものは .ascii の行に分け，終端の '\0' は最後の .string に
+        // 付けてもらう
+        int len = var->cont_len;
+        bool nul = len > 0 && var->contents[len - 1] == '\0';
+        if (nul)
+            len--;
+
+        for (int i = 0;; i += DATA_LINE_LEN) {
+            bool last = len - i <= DATA_LINE_LEN;
+            out_str(last && nul ? "  .string " : "  .ascii ");
+            print_quoted(var->contents + i, last ? len - i : DATA_LINE_LEN);
+            out_char('\n');
+            if (last)
+                break;
+        }
+    }
+}
+
+// Writes the program as Intel-syntax assembly to the output.
+void emit_asm(Program *prog, Insn *insns) {
+    // アセンブリの前半部分を出力
+    out_str(".intel_syntax noprefix\n");
+    emit_data(prog);
+
+    out_str(".text\n");
+
+    // 関数は prog->fns の順に並んでいて，.global なラベルか I_TEXT で始まる
+    Function *fn = NULL;
+    for (Insn *insn = insns; insn; insn = insn->next) {
+        if (insn->kind == I_TEXT || (insn->kind == I_LABEL && insn->global)) {
+            if (fn)
+                cache_end(fn);
+            fn = fn ? fn->next : prog->fns;
+            cache_begin(fn);
+        }
+        print_insn(insn);
+    }
+    if (fn)
+        cache_end(fn);
+}
@@ -0,0 +1,91 @@
+#!/bin/sh
+# Compile-throughput benchmark. Compiles each synthetic corpus from
+# bench/gen.sh several times, reports the best time of each phase with
+# tokens/s, lines/s and output size, and compares against the timings
+# stored in bench/baseline.txt. Exits with 1 if a phase got slower than
+# the baseline by more than BENCH_TOLERANCE percent (default 25).
+#
+# Timings only compare on the same machine, so the baseline is not kept
+# in the repository. Without one, the benchmark only reports.
+#
+# usage: bench/bench.sh [--update] [scale] [runs]
+#
+# --update records this run's timings as the baseline.
+
+dir=$(dirname $0)
+update=
+if [ "$1" = --update ]; then
+    update=1
+    shift
+fi
+scale=${1:-1}
+runs=${2:-5}
+tolerance=${BENCH_TOLERANCE:-25}
+baseline=$dir/baseline.txt
+phases="total tokenize parse codegen emit"
+
+tmp=${TMPDIR:-/tmp}/9cc-bench.$$
+trap 'rm -f $tmp.*' EXIT
+
+if [ -f $baseline ] && [ -z "$update" ] && ! grep -q "^# scale $scale\$" $baseline; then
+    echo "bench: $baseline is for another scale; not comparing"
+    baseline=/dev/null
+fi
+if [ ! -e $baseline ]; then
+    [ -z "$update" ] && echo "bench: no baseline for this machine; run make bench-baseline to record one"
+    baseline=/dev/null
+fi
+[ -n "$update" ] && echo "# scale $scale" > $tmp.base
+
+printf "%-10s %8s %9s %9s %9s %9s %9s %9s %9s %10s %9s\n" \
+    corpus lines tokens "total ms" tokenize parse codegen emit "Mtok/s" "klines/s" "out KB"
+
+fail=0
+for corpus in functions expr strings globals members scopes; do
+    $dir/gen.sh $corpus $scale > $tmp.c
+    lines=$(wc -l < $tmp.c)
+
+    i=0
+    : > $tmp.stats
+    while [ $i -lt $runs ]; do
+        ./9cc --stats -o $tmp.s $tmp.c 2>> $tmp.stats || exit 1
+        i=$((i + 1))
+    done
+
+    # 各フェーズの最短の時間を "phase ms" の形で取り出す
+    awk '
+        NF == 4 && $2 ~ /^[0-9.]+$/ { if (!($1 in best) || $2 < best[$1]) best[$1] = $2 }
+        /^tokens / { tokens = $2 + 0 }
+        /^peak RSS/ { out = $6 }
+        END {
+            for (p in best) print p, best[p]
+            print "tokens", tokens
+            print "output", out
+        }' $tmp.stats > $tmp.best
+
+    get() { awk -v k=$1 '$1 == k { print $2 }' $tmp.best; }
+    total=$(get total)
+    tokens=$(get tokens)
+    echo "$corpus $lines $tokens $total $(get tokenize) $(get parse) $(get codegen) $(get emit) $(get output)" |
+        awk '{ printf "%-10s %8d %9d %9.1f %9.1f %9.1f %9.1f %9.1f %9.2f %10.1f %9.1f\n",
+                   $1, $2, $3, $4, $5, $6, $7, $8, $3 / $4 / 1000, $2 / $4, $9 / 1024 }'
+
+    for phase in $phases; do
+        cur=$(get $phase)
+        [ -n "$update" ] && echo "$corpus $phase $cur" >> $tmp.base
+        base=$(awk -v c=$corpus -v p=$phase '$1 == c && $2 == p { print $3 }' $baseline)
+        [ -z "$base" ] && continue
+
+        # 小さな時間の揺れで失敗しないよう，1 ms 未満の差は無視する
+        if echo "$cur $base" | awk -v t=$tolerance '{ exit !($1 > $2 * (1 + t / 100) && $1 - $2 > 1) }'; then
+            echo "bench: REGRESSION in $corpus/$phase: $cur ms, baseline $base ms"
+            fail=1
+        fi
+    done
+done
+
+if [ -n "$update" ]; then
+    cp $tmp.base $dir/baseline.txt
+    echo "bench: updated $dir/baseline.txt"
+fi
+exit $fail
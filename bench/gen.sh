@@ -0,0 +1,119 @@
+#!/bin/sh
+# Generates a synthetic C program in the subset 9cc accepts.
+#
+# usage: bench/gen.sh <kind> [scale]
+#
+#   functions  many small functions calling each other
+#   expr       deeply nested expressions
+#   strings    huge string literals
+#   globals    many global variables
+#   members    a struct with a long member list
+#   scopes     deeply nested blocks, each declaring variables
+#
+# scale multiplies the size of the input; 1 gives inputs that take
+# 9cc between 10 and 300 ms.
+
+kind=$1
+scale=${2:-1}
+
+case $kind in
+functions)
+    awk -v n=$((5000 * scale)) 'BEGIN {
+        for (i = 0; i < n; i++) {
+            print "int f" i "(int x, int y) {"
+            print "    int i;"
+            print "    int s;"
+            print "    s = 0;"
+            print "    for (i = 0; i < x; i = i + 1) {"
+            print "        if (i < y)"
+            print "            s = s + i * " i % 97 ";"
+            print "        else"
+            print "            s = s - 1;"
+            print "    }"
+            if (i > 0)
+                print "    return s + f" i - 1 "(x - 1, y);"
+            else
+                print "    return s;"
+            print "}"
+        }
+        print "int main() { return 0; }"
+    }'
+    ;;
+expr)
+    awk -v n=$((100 * scale)) -v depth=300 'BEGIN {
+        for (i = 0; i < n; i++) {
+            print "int e" i "(int a, int b) {"
+            printf "    return "
+            for (d = 0; d < depth; d++)
+                printf "(a %s ", substr("+-*+<", d % 5 + 1, 1)
+            printf "b"
+            for (d = 0; d < depth; d++)
+                printf ")"
+            print ";"
+            print "}"
+        }
+        print "int main() { return 0; }"
+    }'
+    ;;
+strings)
+    awk -v n=$((50 * scale)) -v len=100000 'BEGIN {
+        line = ""
+        for (j = 0; j < 100; j++)
+            line = line substr("abcdefghijklmnopqrstuvwxyz0123456789", j % 36 + 1, 1)
+        for (i = 0; i < n; i++) {
+            print "char *s" i "() {"
+            printf "    return \""
+            for (j = 0; j < len / 100; j++)
+                printf "%s%s", line, (j % 10 == 9 ? "\\n\\t\\\"" : "")
+            print "\";"
+            print "}"
+        }
+        print "int main() { return 0; }"
+    }'
+    ;;
+globals)
+    awk -v n=$((20000 * scale)) 'BEGIN {
+        for (i = 0; i < n; i++)
+            print (i % 3 ? "int" : "char") " g" i (i % 7 ? "" : "[" i % 13 + 1 "]") ";"
+        print "int main() {"
+        for (i = 0; i < n - 1; i += 7)
+            print "    g" i "[0] = g" i + 1 ";"
+        print "    return 0;"
+        print "}"
+    }'
+    ;;
+members)
+    awk -v n=$((2000 * scale)) -v fns=$((2000 * scale)) 'BEGIN {
+        print "struct {"
+        for (i = 0; i < n; i++)
+            print "    " (i % 2 ? "char" : "int") " m" i ";"
+        print "} s;"
+        for (i = 0; i < fns; i++) {
+            print "int get" i "() {"
+            print "    return s.m" (i * 37) % n " + s.m" (i * 11) % n " + s.m" n - 1 - i % n ";"
+            print "}"
+        }
+        print "int main() { return 0; }"
+    }'
+    ;;
+scopes)
+    awk -v n=$((20 * scale)) -v depth=200 'BEGIN {
+        for (i = 0; i < n; i++) {
+            print "int n" i "() {"
+            print "    int x;"
+            print "    x = 0;"
+            for (d = 0; d < depth; d++)
+                printf "%*s{ int x%d; int y%d; x%d = x + %d; y%d = x%d;\n", d + 4, "", d, d, d, d, d, d
+            for (d = depth - 1; d >= 0; d--)
+                printf "%*sx = x + y%d; }\n", d + 4, "", d
+            print "    return x;"
+            print "}"
+        }
+        print "int main() { return 0; }"
+    }'
+    ;;
+*)
+    echo "usage: bench/gen.sh <functions|expr|strings|globals|members|scopes> [scale]" >&2
+    exit 1
+    ;;
+esac
@@ -0,0 +1,60 @@
+#!/bin/sh
+# Lexer microbenchmark. Generates a comment-heavy and an identifier-heavy
+# program and reports the best tokenize time out of several runs for each
+# scanner this CPU supports.
+#
+# usage: bench/lexbench.sh [functions] [runs]
+
+nfns=${1:-20000}
+runs=${2:-5}
+tmp=${TMPDIR:-/tmp}/9cc-lexbench.$$
+trap 'rm -f $tmp.*' EXIT
+
+awk -v n=$nfns 'BEGIN {
+    for (i = 0; i < n; i++) {
+        print "/*"
+        print " * Function number " i ". This block comment is here to make"
+        print " * the input comment-heavy, with * stars and \"quotes\" inside."
+        print " */"
+        print "int f" i "(int x) {"
+        print "    // the body is short; most of the bytes are in comments"
+        print "    return x + " i "; // trailing comment"
+        print "}"
+    }
+    print "int main() { return 0; }"
+}' > $tmp.comment.c
+
+awk -v n=$nfns 'BEGIN {
+    for (i = 0; i < n; i++) {
+        print "int function_with_a_long_descriptive_name_" i "(int first_argument_value, int second_argument_value) {"
+        print "    int intermediate_accumulated_result;"
+        print "    intermediate_accumulated_result = first_argument_value * second_argument_value;"
+        print "    return intermediate_accumulated_result + first_argument_value - second_argument_value;"
+        print "}"
+    }
+    print "int main() { return 0; }"
+}' > $tmp.ident.c
+
+scans=
+for scan in scalar sse2 avx2; do
+    ./9cc --scan=$scan --dump-tokens /dev/null > /dev/null 2>&1 && scans="$scans $scan"
+done
+
+# 負荷の揺れがどのスキャナにも同じように効くよう，1回ずつ交互に測る
+for corpus in comment ident; do
+    size=$(wc -c < $tmp.$corpus.c)
+    rm -f $tmp.best.*
+    i=0
+    while [ $i -lt $runs ]; do
+        for scan in $scans; do
+            t=$(./9cc --scan=$scan --stats -o /dev/null $tmp.$corpus.c 2>&1 | awk '/^tokenize/ { print $2 }')
+            best=$(cat $tmp.best.$scan 2>/dev/null)
+            echo "$t $best" | awk '{ print ($2 == "" || $1 < $2) ? $1 : $2 }' > $tmp.best.$scan
+        done
+        i=$((i + 1))
+    done
+    for scan in $scans; do
+        echo "$corpus $scan $(cat $tmp.best.$scan) ms $size bytes" |
+            awk '{ printf "%-8s %-7s %9.3f ms %8.1f MB/s\n", $1, $2, $3, $5 / $3 / 1000 }'
+    done
+done
@@ -0,0 +1,95 @@
+// Compile throughput of the library interface. Compiles each file many
+// times with compile() on one reused context, then the same number of
+// times by running the 9cc command, and prints compiles per second for
+// both.
+//
+// usage: libbench <9cc> <iterations> <file>...
+
+#include "../9cc.h"
+#include <spawn.h>
+#include <sys/wait.h>
+#include <time.h>
+
+extern char **environ;
+
+static char *read_all(char *path, size_t *len) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        perror(path);
+        exit(2);
+    }
+    fseek(fp, 0, SEEK_END);
+    *len = ftell(fp);
+    rewind(fp);
+    char *buf = malloc(*len + 1);
+    if (fread(buf, 1, *len, fp) != *len) {
+        perror(path);
+        exit(2);
+    }
+    fclose(fp);
+    return buf;
+}
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double bench_lib(char *path, char *src, size_t len, int n) {
+    CompileContext *c = context_new();
+    double start = now();
+    for (int i = 0; i < n; i++) {
+        if (compile(c, path, src, len)) {
+            fprintf(stderr, "libbench: %s: %s\n", path, c->diags[0].message);
+            exit(1);
+        }
+    }
+    double t = now() - start;
+    context_free(c);
+    return t;
+}
+
+static double bench_exec(char *cc, char *path, int n) {
+    char *argv[] = {cc, "-o", "/dev/null", path, NULL};
+    double start = now();
+    for (int i = 0; i < n; i++) {
+        pid_t pid;
+        int status;
+        if (posix_spawn(&pid, cc, NULL, NULL, argv, environ)) {
+            perror(cc);
+            exit(2);
+        }
+        if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status)) {
+            fprintf(stderr, "libbench: %s failed on %s\n", cc, path);
+            exit(1);
+        }
+    }
+    return now() - start;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: libbench <9cc> <iterations> <file>...\n");
+        return 2;
+    }
+    char *cc = argv[1];
+    int n = atoi(argv[2]);
+
+    printf("%-24s %8s %14s %14s %8s\n", "file", "bytes", "compile()/s", "fork+exec/s", "speedup");
+    for (int i = 3; i < argc; i++) {
+        size_t len;
+        char *src = read_all(argv[i], &len);
+
+        // 1回目はページフォルトなどが入るので測らない
+        bench_lib(argv[i], src, len, 1);
+        double lib = bench_lib(argv[i], src, len, n);
+        double exec = bench_exec(cc, argv[i], n);
+
+        char *name = strrchr(argv[i], '/');
+        printf("%-24s %8zu %14.0f %14.0f %7.1fx\n", name ? name + 1 : argv[i], len,
+               n / lib, n / exec, exec / lib);
+        free(src);
+    }
+    return 0;
+}
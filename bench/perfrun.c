@@ -0,0 +1,90 @@
+// Runs a program and prints its cycles, instructions retired and wall
+// time on one line. Counters come from perf_event_open(2) and count
+// user space only; if they are not available, "-" is printed instead.
+// The exit status is that of the program.
+//
+// usage: perfrun <program> [args...]
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static int open_counter(pid_t pid, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+static void print_counter(int fd) {
+    uint64_t val;
+    if (fd >= 0 && read(fd, &val, sizeof(val)) == sizeof(val))
+        printf(" %llu", (unsigned long long)val);
+    else
+        printf(" -");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: perfrun <program> [args...]\n");
+        return 2;
+    }
+
+    // 子プロセスはカウンタを開き終わるまでパイプで待たせておく
+    int go[2];
+    if (pipe(go)) {
+        perror("pipe");
+        return 2;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        char c;
+        close(go[1]);
+        if (read(go[0], &c, 1) != 1)
+            _exit(127);
+        execv(argv[1], argv + 1);
+        perror(argv[1]);
+        _exit(127);
+    }
+
+    int cycles = open_counter(pid, PERF_COUNT_HW_CPU_CYCLES);
+    int insns = open_counter(pid, PERF_COUNT_HW_INSTRUCTIONS);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    close(go[0]);
+    if (write(go[1], "x", 1) != 1) {
+        perror("write");
+        return 2;
+    }
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0)
+        if (errno != EINTR) {
+            perror("waitpid");
+            return 2;
+        }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("cycles");
+    print_counter(cycles);
+    printf(" instructions");
+    print_counter(insns);
+    printf(" wall_ms %.3f\n", (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
@@ -0,0 +1,12 @@
+// Recursive calls: call/return overhead and argument passing.
+int fib(int n) {
+    if (n < 2)
+        return n;
+    return fib(n - 1) + fib(n - 2);
+}
+
+int main() {
+    if (fib(30) == 832040)
+        return 0;
+    return 1;
+}
@@ -0,0 +1,32 @@
+// Matrix multiply over int[N][N]: nested loops and two-level indexing.
+int a[120][120];
+int b[120][120];
+int c[120][120];
+
+int main() {
+    int i;
+    int j;
+    int k;
+    int s;
+    for (i = 0; i < 120; i = i + 1)
+        for (j = 0; j < 120; j = j + 1) {
+            a[i][j] = i + j;
+            b[i][j] = i - j;
+        }
+
+    for (i = 0; i < 120; i = i + 1)
+        for (j = 0; j < 120; j = j + 1) {
+            s = 0;
+            for (k = 0; k < 120; k = k + 1)
+                s = s + a[i][k] * b[k][j];
+            c[i][j] = s;
+        }
+
+    // c[i][j] = sum_k (i + k)(k - j)
+    s = 0;
+    for (k = 0; k < 120; k = k + 1)
+        s = s + (3 + k) * (k - 5);
+    if (c[3][5] == s)
+        return 0;
+    return 1;
+}
@@ -0,0 +1,39 @@
+// Pointer-walking string loops: byte loads and pointer increments.
+char buf[8192];
+
+int length(char *s) {
+    char *p;
+    p = s;
+    while (*p)
+        p = p + 1;
+    return p - s;
+}
+
+int count(char *s, char c) {
+    int n;
+    n = 0;
+    for (; *s; s = s + 1)
+        if (*s == c)
+            n = n + 1;
+    return n;
+}
+
+int main() {
+    char *p;
+    int i;
+    int r;
+    int s;
+    p = buf;
+    for (i = 0; i < 8000; i = i + 1) {
+        *p = 97 + i - i / 26 * 26;
+        p = p + 1;
+    }
+
+    s = 0;
+    for (r = 0; r < 100; r = r + 1)
+        s = s + length(buf) + count(buf, 122);
+
+    if (s == 100 * (8000 + 307))
+        return 0;
+    return 1;
+}
@@ -0,0 +1,29 @@
+// Traversal of an array of structs: member offsets and scaled indexing.
+struct {
+    int x;
+    int y;
+    char tag;
+    int weight;
+} pts[4096];
+
+int main() {
+    int i;
+    int r;
+    int s;
+    for (i = 0; i < 4096; i = i + 1) {
+        pts[i].x = i;
+        pts[i].y = 2;
+        pts[i].tag = 1;
+        pts[i].weight = 3;
+    }
+
+    s = 0;
+    for (r = 0; r < 200; r = r + 1)
+        for (i = 0; i < 4096; i = i + 1)
+            if (pts[i].tag)
+                s = s + pts[i].x * pts[i].y + pts[i].weight;
+
+    if (s / 200 == 4096 * 4095 + 4096 * 3)
+        return 0;
+    return 1;
+}
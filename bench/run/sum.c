@@ -0,0 +1,19 @@
+// Array sum loop: loads, induction variables and loop branches.
+int a[10000];
+
+int main() {
+    int i;
+    int r;
+    int s;
+    for (i = 0; i < 10000; i = i + 1)
+        a[i] = i;
+
+    s = 0;
+    for (r = 0; r < 300; r = r + 1)
+        for (i = 0; i < 10000; i = i + 1)
+            s = s + a[i];
+
+    if (s / 300 == 49995000)
+        return 0;
+    return 1;
+}
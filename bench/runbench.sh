@@ -0,0 +1,45 @@
+#!/bin/sh
+# Runtime benchmark of the code 9cc generates. Compiles each program in
+# bench/run with several option sets, then runs it under bench/perfrun.
+# It reports the .text size, the cycles and instructions retired, and
+# the wall time. Each program checks its own result and exits with 0,
+# so a miscompile makes the harness fail.
+#
+# usage: bench/runbench.sh [runs]
+
+dir=$(dirname $0)
+runs=${1:-3}
+tmp=${TMPDIR:-/tmp}/9cc-runbench.$$
+trap 'rm -f $tmp $tmp.*' EXIT
+
+cc -O2 -o $tmp.perfrun $dir/perfrun.c || exit 1
+
+printf "%-10s %-16s %8s %14s %14s %10s\n" program options "text B" cycles instructions "wall ms"
+
+fail=0
+for src in $dir/run/*.c; do
+    name=$(basename $src .c)
+    for opts in "" "--regalloc" "-O1" "-O1 --regalloc"; do
+        ./9cc $opts -o $tmp.s $src || exit 1
+        cc -c -o $tmp.o $tmp.s || exit 1
+        cc -static -o $tmp $tmp.o 2> /dev/null || exit 1
+        text=$(size -A $tmp.o | awk '$1 == ".text" { print $2 }')
+
+        # 最も速かった回の値を使う
+        i=0
+        : > $tmp.runs
+        while [ $i -lt $runs ]; do
+            if ! $tmp.perfrun $tmp >> $tmp.runs; then
+                echo "runbench: $name ${opts:-(default)} returned a wrong result"
+                fail=1
+            fi
+            i=$((i + 1))
+        done
+
+        awk -v name=$name -v opts="${opts:-(default)}" -v text=$text '
+            { if (best == "" || $6 < best) { best = $6; cycles = $2; insns = $4 } }
+            END { printf "%-10s %-16s %8d %14s %14s %10.2f\n", name, opts, text, cycles, insns, best }
+        ' $tmp.runs
+    done
+done
+exit $fail
@@ -0,0 +1,247 @@
+#include "9cc.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 関数ごとのアセンブリのキャッシュ．
+//
+// キーは関数定義のトークン列と，その関数のコードを左右する外のもの
+// (参照しているグローバル変数の名前と型，使っている構造体の配置，
+// コンパイラ自身とオプション) のハッシュ．キャッシュにあった関数は
+// コード生成を飛ばして，前回の出力をそのまま書き出す
+
+// 衝突で間違ったコードを出さないよう，64ビットのハッシュを2つ使う
+typedef struct {
+    uint64_t a;
+    uint64_t b;
+} Hash;
+
+static void mix(Hash *h, uint64_t w) {
+    h->a = (h->a ^ w) * 0x100000001b3;
+    h->a ^= h->a >> 32;
+    h->b = (h->b ^ w) * 0x9e3779b97f4a7c15;
+    h->b ^= h->b >> 29;
+}
+
+// 1バイトずつではなく8バイトずつ混ぜる
+static void hash_bytes(Hash *h, void *p, size_t len) {
+    char *s = p;
+    uint64_t w;
+    for (; len >= 8; s += 8, len -= 8) {
+        memcpy(&w, s, 8);
+        mix(h, w);
+    }
+    if (len) {
+        w = 0;
+        memcpy(&w, s, len);
+        mix(h, w);
+    }
+}
+
+static void hash_int(Hash *h, long val) {
+    mix(h, val);
+}
+
+// 長さも入れて，続くものとの区切りが曖昧にならないようにする
+static void hash_str(Hash *h, char *s, int len) {
+    hash_int(h, len);
+    hash_bytes(h, s, len);
+}
+
+// 構造体のメンバは1段だけたどる．メンバの先の構造体は，それを使う
+// ノードの型として別に入る
+static void hash_type(Hash *h, Type *ty, bool members) {
+    if (!ty) {
+        hash_int(h, -1);
+        return;
+    }
+    hash_int(h, ty->kind);
+    hash_int(h, ty->size);
+    hash_int(h, ty->array_len);
+    if (ty->base)
+        hash_type(h, ty->base, false);
+    if (members && ty->kind == TY_STRUCT)
+        for (Member *mem = ty->members; mem; mem = mem->next) {
+            hash_str(h, mem->name, strlen(mem->name));
+            hash_int(h, mem->offset);
+            hash_type(h, mem->ty, false);
+        }
+}
+
+static void walk(Node *node, void (*visit)(Node *node, void *arg), void *arg) {
+    for (; node; node = node->next) {
+        visit(node, arg);
+        walk(node->lhs, visit, arg);
+        walk(node->rhs, visit, arg);
+        walk(node->cond, visit, arg);
+        walk(node->then, visit, arg);
+        walk(node->els, visit, arg);
+        walk(node->init, visit, arg);
+        walk(node->inc, visit, arg);
+        walk(node->body, visit, arg);
+        walk(node->args, visit, arg);
+    }
+}
+
+// トークン列からは分からないもの
+static void hash_refs(Node *node, void *arg) {
+    Hash *h = arg;
+    hash_type(h, node->ty, true);
+    if (node->kind == ND_VAR && !node->var->is_local) {
+        // 文字列リテラルのラベルもここに入る
+        hash_str(h, node->var->name, strlen(node->var->name));
+        hash_type(h, node->var->ty, true);
+    }
+    if (node->kind == ND_MEMBER)
+        hash_int(h, node->member->offset);
+}
+
+typedef struct {
+    Hash *h;
+    HashMap *keys;   // 関数名 -> その関数だけのハッシュ
+} CallArg;
+
+// -O1 では呼び出し先がインライン展開されるかもしれないので，その中身も入れる
+static void hash_calls(Node *node, void *arg) {
+    CallArg *ca = arg;
+    if (node->kind != ND_FUNCALL)
+        return;
+    hash_str(ca->h, node->funcname, strlen(node->funcname));
+    Hash *callee = hashmap_get(ca->keys, node->funcname);
+    if (callee)
+        hash_bytes(ca->h, callee, sizeof(Hash));
+    else
+        hash_int(ca->h, 0);
+}
+
+// Returns the hash of things that affect every function: the compiler
+// binary itself and the code generation options.
+static Hash hash_compiler() {
+    Hash h = {0xcbf29ce484222325, 0x84222325cbf29ce4};
+    hash_str(&h, "9cc cache 1", 11);
+
+    struct stat st;
+    if (!stat("/proc/self/exe", &st)) {
+        hash_int(&h, st.st_size);
+        hash_int(&h, st.st_mtim.tv_sec);
+        hash_int(&h, st.st_mtim.tv_nsec);
+    }
+    hash_int(&h, ctx->opt_level);
+    hash_int(&h, ctx->opt_regalloc);
+    return h;
+}
+
+static Hash hash_function(Hash h, Function *fn) {
+    for (Token tok = fn->tok_begin; tok < fn->tok_end; tok++) {
+        hash_int(&h, ctx->tokens.kind[tok]);
+        hash_str(&h, tok_str(tok), ctx->tokens.len[tok]);
+    }
+    for (VarList *vl = fn->locals; vl; vl = vl->next)
+        hash_type(&h, vl->var->ty, true);
+    walk(fn->node, hash_refs, &h);
+    return h;
+}
+
+// Returns the contents of a file as a NUL-terminated string, or NULL
+// if it cannot be read.
+static char *read_cached(char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    char *buf = NULL;
+    if (!fstat(fd, &st)) {
+        buf = arena_alloc(&ctx->parse_arena, st.st_size + 1);
+        size_t len = 0;
+        while (len < st.st_size) {
+            ssize_t n = read(fd, buf + len, st.st_size - len);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            len += n;
+        }
+        if (len < st.st_size)
+            buf = NULL;
+        else
+            buf[len] = '\0';
+    }
+    close(fd);
+    return buf;
+}
+
+// Computes the cache key of every function and loads the assembly of
+// the ones that are in the cache into fn->cached. Must be called after
+// fold() and before inline_functions().
+void cache_lookup(Program *prog) {
+    char *dir = ctx->cache_dir;
+    if (mkdir(dir, 0777) && errno != EEXIST)
+        error("cannot create %s: %s", dir, strerror(errno));
+
+    Hash common = hash_compiler();
+    HashMap keys = {.arena = &ctx->parse_arena};
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        Hash *h = arena_alloc(&ctx->parse_arena, sizeof(Hash));
+        *h = hash_function(common, fn);
+        hashmap_put(&keys, fn->name, h);
+    }
+
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        Hash h = *(Hash *)hashmap_get(&keys, fn->name);
+        if (ctx->opt_level >= 1)
+            walk(fn->node, hash_calls, &(CallArg){&h, &keys});
+
+        int len = strlen(dir) + 40;
+        fn->cache_key = arena_alloc(&ctx->parse_arena, len);
+        snprintf(fn->cache_key, len, "%s/%016lx%016lx.s", dir, h.a, h.b);
+
+        fn->cached = read_cached(fn->cache_key);
+        if (fn->cached)
+            ctx->counts.cache_hits++;
+        else
+            ctx->counts.cache_misses++;
+    }
+}
+
+// Starts recording the assembly of a function that was not in the cache.
+void cache_begin(Function *fn) {
+    if (fn->cache_key && !fn->cached)
+        out_capture_begin();
+}
+
+// Stores the assembly recorded since cache_begin() in the cache. The
+// file is written under a temporary name and renamed, so that another
+// compiler running at the same time never reads a half-written file.
+// The cache is only an optimization, so failures are ignored.
+void cache_end(Function *fn) {
+    if (!fn->cache_key || fn->cached)
+        return;
+
+    int len;
+    char *text = out_capture_end(&len);
+
+    // 同じプロセスの別のコンテキストが同じ関数を書いていることもある
+    int tmplen = strlen(fn->cache_key) + 48;
+    char *tmp = malloc(tmplen);
+    snprintf(tmp, tmplen, "%s.%d.%p.tmp", fn->cache_key, getpid(), (void *)ctx);
+
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+        return;
+    bool ok = true;
+    while (len > 0) {
+        ssize_t n = write(fd, text, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            ok = false;
+            break;
+        }
+        text += n;
+        len -= n;
+    }
+    if (close(fd) || !ok || rename(tmp, fn->cache_key))
+        unlink(tmp);
+    free(tmp);
+}
@@ -1,309 +1,536 @@
 #include "9cc.h"
+#include <pthread.h>
 
-static char *argreg1[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
-static char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+// 関数ごとに AST を IR (ir.c) に下ろし，IR の命令ごとに x86-64 の命令を選ぶ
 
-static int labelseq = 1;
-static char *funcname;
+static Reg argreg[] = {RDI, RSI, RDX, RCX, R8, R9};
 
-static void gen(Node *node);
+// 以下はコード生成中の関数の状態．関数ごとに別のスレッドで生成するので
+// スレッドごとに持つ
+static _Thread_local char *funcname;
+static _Thread_local Loc *locs;       // 仮想レジスタ番号 -> 置き場所
+static _Thread_local char **labels;   // ブロック番号 -> ラベル
+static _Thread_local bool *reachable; // ブロック番号 -> 入口から到達できるか
 
-// Pushes the given node's address to the stack.
-static void gen_addr(Node *node) {
-    switch (node->kind) {
-        case ND_VAR: {
-            Var *var = node->var;
-            if (var->is_local) {
-                printf("  lea rax, [rbp-%d]\n", var->offset);
-                printf("  push rax\n");
-            } else {
-                printf("  push offset %s\n", var->name);
+// 生成した命令列の末尾
+static _Thread_local Insn *out;
+// 命令とラベル名の確保先．生成中の関数のアリーナ
+static _Thread_local Arena *insn_arena;
+
+// ラベルは関数名を含むので長さに上限はない．必要な長さを測ってから確保する
+static char *format(char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+
+    char *buf = arena_alloc(insn_arena, len + 1);
+    va_start(ap, fmt);
+    vsnprintf(buf, len + 1, fmt, ap);
+    va_end(ap);
+    return buf;
+}
+
+static Operand reg(Reg r) {
+    return (Operand){OPD_REG, r, 8};
+}
+
+static Operand reg8(Reg r) {
+    return (Operand){OPD_REG, r, 1};
+}
+
+static Operand imm(long val) {
+    return (Operand){OPD_IMM, .imm = val};
+}
+
+static Operand mem(Reg base, int disp, int size) {
+    return (Operand){OPD_MEM, base, size, disp};
+}
+
+static Operand sym(char *name) {
+    return (Operand){OPD_SYM, .name = name};
+}
+
+static Operand label(char *name) {
+    return (Operand){OPD_LABEL, .name = name};
+}
+
+static Insn *emit(InsnKind kind, Operand dst, Operand src) {
+    Insn *insn = arena_alloc(insn_arena, sizeof(Insn));
+    insn->kind = kind;
+    insn->dst = dst;
+    insn->src = src;
+    out = out->next = insn;
+    return insn;
+}
+
+static Insn *emit1(InsnKind kind, Operand opd) {
+    return emit(kind, opd, (Operand){});
+}
+
+static void emit0(InsnKind kind) {
+    emit(kind, (Operand){}, (Operand){});
+}
+
+static Insn *emit_label(char *name) {
+    return emit1(I_LABEL, label(name));
+}
+
+// x86 の条件コードは最下位ビットを反転すると逆の条件になる
+CondCode negate_cc(CondCode cc) {
+    return cc ^ 1;
+}
+
+static void emit_jcc(CondCode cc, char *name) {
+    emit1(I_JCC, label(name))->cc = cc;
+}
+
+static bool in_reg(int v, Reg r) {
+    return locs[v].kind == LOC_REG && locs[v].reg == r;
+}
+
+// Returns v as an instruction operand: a register, a frame slot or an
+// immediate. An address of a local variable is first computed into
+// scratch.
+static Operand use(int v, Reg scratch) {
+    Loc *loc = &locs[v];
+    switch (loc->kind) {
+        case LOC_REG:
+            return reg(loc->reg);
+        case LOC_STACK:
+            return mem(RBP, -loc->offset, 8);
+        case LOC_IMM:
+            return imm(loc->imm);
+        case LOC_LVAR:
+            emit(I_LEA, reg(scratch), mem(RBP, -loc->offset, 8));
+            return reg(scratch);
+    }
+    unreachable();
+}
+
+// Copies the value of v to register r.
+static void load(Reg r, int v) {
+    if (in_reg(v, r))
+        return;
+    Operand opd = use(v, r);
+    if (opd.kind != OPD_REG || opd.reg != r)
+        emit(I_MOV, reg(r), opd);
+}
+
+// Returns a register holding v, loading v into scratch if it is not
+// already in a register.
+static Reg use_reg(int v, Reg scratch) {
+    if (locs[v].kind == LOC_REG)
+        return locs[v].reg;
+    load(scratch, v);
+    return scratch;
+}
+
+// Returns the register to compute v into: its own register if it has
+// one, RAX otherwise.
+static Reg def_reg(int v) {
+    return locs[v].kind == LOC_REG ? locs[v].reg : RAX;
+}
+
+// Writes register r to the location of v.
+static void def(int v, Reg r) {
+    if (!in_reg(v, r))
+        emit(I_MOV, use(v, RAX), reg(r));
+}
+
+// Returns the memory operand for a size-byte access through the address
+// in v.
+static Operand deref(int v, int size) {
+    if (locs[v].kind == LOC_LVAR)
+        return mem(RBP, -locs[v].offset, size);
+    return mem(use_reg(v, RAX), 0, size);
+}
+
+static bool is_folded(int v) {
+    return locs[v].kind == LOC_IMM || locs[v].kind == LOC_LVAR;
+}
+
+static bool is_comparison(IR *ir) {
+    return ir->op == IR_EQ || ir->op == IR_NE || ir->op == IR_LT || ir->op == IR_LE;
+}
+
+// Folds constants, addresses of local variables and sums of the two into
+// the instructions that use them instead of computing them at run time.
+// A comparison whose only use is the branch right after it is left in the
+// flags. All other virtual registers are left as LOC_NONE for regalloc().
+static void fold_locs(IRFunc *f) {
+    locs = arena_alloc(insn_arena, (f->nreg + 1) * sizeof(Loc));
+    int *nuses = arena_alloc(insn_arena, (f->nreg + 1) * sizeof(int));
+
+    for (BB *bb = f->bbs; bb; bb = bb->next) {
+        for (IR *ir = bb->ir; ir; ir = ir->next) {
+            nuses[ir->a]++;
+            nuses[ir->b]++;
+            for (int i = 0; i < ir->nargs; i++)
+                nuses[ir->args[i]]++;
+
+            Loc *a = &locs[ir->a];
+            Loc *b = &locs[ir->b];
+            Loc *d = &locs[ir->dst];
+            long val;
+
+            switch (ir->op) {
+                case IR_IMM:
+                    *d = (Loc){LOC_IMM, .imm = ir->imm};
+                    break;
+                case IR_ADDR:
+                    if (ir->var->is_local)
+                        *d = (Loc){LOC_LVAR, .offset = ir->var->offset};
+                    break;
+                case IR_ADD:
+                case IR_SUB:
+                case IR_MUL:
+                    if (a->kind == LOC_IMM && b->kind == LOC_IMM) {
+                        val = ir->op == IR_ADD ? a->imm + b->imm :
+                              ir->op == IR_SUB ? a->imm - b->imm : a->imm * b->imm;
+                        if (INT32_MIN <= val && val <= INT32_MAX)
+                            *d = (Loc){LOC_IMM, .imm = val};
+                        break;
+                    }
+                    // rbp-offset+imm も rbp からの相対で表せる
+                    if (ir->op != IR_MUL && a->kind == LOC_LVAR && b->kind == LOC_IMM) {
+                        val = ir->op == IR_ADD ? a->offset - b->imm : a->offset + b->imm;
+                        *d = (Loc){LOC_LVAR, .offset = val};
+                    }
+                    break;
             }
-            return;
         }
-        case ND_MEMBER:
-            gen_addr(node->lhs);
-            printf("  pop rax\n");
-            printf("  add rax, %d\n", node->member->offset);
-            printf("  push rax\n");
-            return;
-        case ND_DEREF:
-            gen(node->lhs);
-            return;
     }
 
-    error_tok(node->tok, "Not an lvalue");
-}
-
-static void gen_lval(Node *node) {
-    if (node->ty->kind == TY_ARRAY)
-        error_tok(node->tok, "not an lvalue");
-    gen_addr(node);
-}
-
-static void load(Type *ty) {
-    printf("  pop rax\n");
-    if (ty->size == 1)
-        printf("  movsx rax, byte ptr [rax]\n");
-    else
-        printf("  mov rax, [rax]\n");
-    printf("  push rax\n");
-}
-
-static void store(Type *ty) {
-    printf("  pop rdi\n");
-    printf("  pop rax\n");
-
-    if (ty->size == 1)
-        printf("  mov [rax], dil\n");
-    else
-        printf("  mov [rax], rdi\n");
-
-    printf("  push rdi\n");
-}
-
-// statement 系
-static void gen(Node *node) {
-    switch (node->kind) {
-        case ND_NULL:
-            return;
-        case ND_NUM:
-            printf("  push %d\n", node->val);
-            return;
-        case ND_EXPR_STMT:
-            gen(node->lhs);
-            printf("  add rsp, 8\n");
-            return;
-        case ND_VAR:
-        case ND_MEMBER:
-            gen_addr(node);
-            if (node->ty->kind != TY_ARRAY)
-                load(node->ty);
-            return;
-        case ND_ASSIGN:
-            gen_lval(node->lhs);
-            gen(node->rhs);
-            store(node->ty);
-            return;
-        case ND_ADDR:
-            gen_addr(node->lhs);
-            return;
-        case ND_DEREF:
-            gen(node->lhs);
-            if (node->ty->kind != TY_ARRAY)
-                load(node->ty);
-            return;
-        case ND_IF: {
-            int seq = labelseq++;
-            if (node->els) {
-                gen(node->cond);
-                printf("  pop rax\n");
-                printf("  cmp rax, 0\n");
-                printf("  je  .L.else.%d\n", seq);
-                gen(node->then);
-                printf("  jmp .L.end.%d\n", seq);
-                printf(".L.else.%d:\n", seq);
-                gen(node->els);
-                printf(".L.end.%d:\n", seq);
+    for (BB *bb = f->bbs; bb; bb = bb->next)
+        for (IR *ir = bb->ir; ir; ir = ir->next)
+            if (is_comparison(ir) && ir->next->op == IR_BR &&
+                ir->next->a == ir->dst && nuses[ir->dst] == 1)
+                locs[ir->dst].kind = LOC_FLAGS;
+}
+
+// 入口から到達できないブロック (return の後ろなど) は出力しない．
+// ブロックは必ず分岐か return で終わる
+static void mark_reachable(IRFunc *f) {
+    reachable = arena_alloc(insn_arena, (f->nbb + 1) * sizeof(bool));
+    BB **stack = arena_alloc(insn_arena, f->nbb * sizeof(BB *));
+    int sp = 0;
+
+    reachable[f->bbs->label] = true;
+    stack[sp++] = f->bbs;
+    while (sp > 0) {
+        IR *ir = stack[--sp]->last;
+        BB *succ[2] = {};
+        if (ir->op == IR_JMP) {
+            succ[0] = ir->then;
+        } else if (ir->op == IR_BR) {
+            if (locs[ir->a].kind == LOC_IMM) {
+                succ[0] = locs[ir->a].imm ? ir->then : ir->els;
             } else {
-                gen(node->cond);
-                printf("  pop rax\n");
-                printf("  cmp rax, 0\n");
-                printf("  je  .L.end.%d\n", seq);
-                gen(node->then);
-                printf(".L.end.%d:\n", seq);
+                succ[0] = ir->then;
+                succ[1] = ir->els;
             }
-            return;
         }
-        case ND_WHILE: {
-            int seq = labelseq++;
-            printf(".L.begin.%d:\n", seq);
-            gen(node->cond);
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
-            printf("  je  .L.end.%d\n", seq);
-            gen(node->then);
-            printf("  jmp .L.begin.%d\n", seq);
-            printf(".L.end.%d:\n", seq);
-            return;
-        }
-        case ND_FOR: {
-            int seq = labelseq++;
-            if (node->init)
-                gen(node->init);
-            printf(".L.begin.%d:\n", seq);
-            if (node->cond) {
-                gen(node->cond);
-                printf("  pop rax\n");
-                printf("  cmp rax, 0\n");
-                printf("  je  .L.end.%d\n", seq);
+
+        for (int i = 0; i < 2; i++) {
+            if (succ[i] && !reachable[succ[i]->label]) {
+                reachable[succ[i]->label] = true;
+                stack[sp++] = succ[i];
             }
-            gen(node->then);
-            if (node->inc)
-                gen(node->inc);
-            printf("  jmp .L.begin.%d\n", seq);
-            printf(".L.end.%d:\n", seq);
-            return;
         }
-        case ND_BLOCK:
-        case ND_STMT_EXPR:
-            for (Node *n = node->body; n; n = n->next)
-                gen(n);
-            return;
-        case ND_FUNCALL: {
-            int nargs = 0;
-            for (Node *arg = node->args; arg; arg = arg->next) {
-                gen(arg);
-                nargs++;
-            }
+    }
+}
 
-            for (int i = nargs - 1; i >= 0; i--)
-                printf("  pop %s\n", argreg8[i]);
-
-            // ABIの要求により，関数呼び出しの前にRSPを16バイト境界に揃えなくてはならない
-            int seq = labelseq++;
-            printf("  mov rax, rsp\n");
-            printf("  and rax, 15\n");
-            printf("  jnz .L.call.%d\n", seq);
-            printf("  mov rax, 0\n");
-            printf("  call %s\n", node->funcname);
-            printf("  jmp .L.end.%d\n", seq);
-            printf(".L.call.%d:\n", seq);
-            printf("  sub rsp, 8\n");
-            printf("  mov rax, 0\n");
-            printf("  call %s\n", node->funcname);
-            printf("  add rsp, 8\n");
-            printf(".L.end.%d:\n", seq);
-            printf("  push rax\n");
-            return;
-        }
-        case ND_RETURN:
-            gen(node->lhs);
-            printf("  pop rax\n");
-            printf("  jmp .L.return.%s\n", funcname);
-            return;
+static CondCode cond_code(IROp op) {
+    switch (op) {
+        case IR_EQ: return CC_E;
+        case IR_NE: return CC_NE;
+        case IR_LT: return CC_L;
+        case IR_LE: return CC_LE;
     }
+    unreachable();
+}
 
-    gen(node->lhs);
-    gen(node->rhs);
+// Jumps to then if cc holds and to els otherwise. A jump to next, the
+// block emitted right after this one, falls through instead.
+static void gen_jcc(CondCode cc, BB *then, BB *els, BB *next) {
+    if (then == next) {
+        emit_jcc(negate_cc(cc), labels[els->label]);
+        return;
+    }
+    emit_jcc(cc, labels[then->label]);
+    if (els != next)
+        emit1(I_JMP, label(labels[els->label]));
+}
 
-    printf("  pop rdi\n");
-    printf("  pop rax\n");
+// add/sub/imul
+static void gen_arith(InsnKind kind, IR *ir) {
+    Reg r = def_reg(ir->dst);
+    if (in_reg(ir->b, r))
+        r = RAX;
+    load(r, ir->a);
+    emit(kind, reg(r), use(ir->b, RDI));
+    def(ir->dst, r);
+}
+
+// Emits the instruction for ir and returns the next IR to emit. A
+// comparison whose only use is the branch right after it is emitted
+// together with the branch, so the branch tests the flags directly
+// instead of a 0/1 value.
+static IR *gen_insn(IR *ir, BB *next) {
+    int d = ir->dst;
+    if (d && is_folded(d))
+        return ir->next;
 
-    // expression 系
-    switch (node->kind) {
-        case ND_ADD:
-            printf("  add rax, rdi\n");
+    switch (ir->op) {
+        case IR_ADDR: {
+            // ローカル変数のアドレスは畳み込まれているので，ここに来るのは
+            // グローバル変数だけ
+            Reg r = def_reg(d);
+            emit(I_MOV, reg(r), sym(ir->var->name));
+            def(d, r);
+            break;
+        }
+        case IR_ADD:
+            gen_arith(I_ADD, ir);
+            break;
+        case IR_SUB:
+            gen_arith(I_SUB, ir);
+            break;
+        case IR_MUL:
+            gen_arith(I_IMUL, ir);
             break;
-        case ND_PTR_ADD:
-            printf("  imul rdi, %d\n", node->ty->base->size);
-            printf("  add rax, rdi\n");
+        case IR_DIV:
+            load(RAX, ir->a);
+            emit0(I_CQO);
+            emit1(I_IDIV, reg(use_reg(ir->b, RDI)));
+            def(d, RAX);
             break;
-        case ND_SUB:
-            printf("  sub rax, rdi\n");
+        case IR_SHL: {
+            Reg r = def_reg(d);
+            if (locs[ir->b].kind == LOC_IMM) {
+                load(r, ir->a);
+                emit(I_SHL, reg(r), imm(locs[ir->b].imm));
+            } else {
+                load(RCX, ir->b);
+                load(r, ir->a);
+                emit(I_SHL, reg(r), reg8(RCX));
+            }
+            def(d, r);
             break;
-        case ND_PTR_SUB:
-            printf("  imul rdi, %d\n", node->ty->base->size);
-            printf("  sub rax, rdi\n");
+        }
+        case IR_EQ:
+        case IR_NE:
+        case IR_LT:
+        case IR_LE: {
+            emit(I_CMP, reg(use_reg(ir->a, RAX)), use(ir->b, RDI));
+            if (locs[d].kind == LOC_FLAGS) {
+                IR *br = ir->next;
+                gen_jcc(cond_code(ir->op), br->then, br->els, next);
+                return br->next;
+            }
+            emit1(I_SET, reg8(RAX))->cc = cond_code(ir->op);
+            emit(I_MOVZX, reg(RAX), reg8(RAX));
+            def(d, RAX);
             break;
-        case ND_PTR_DIFF:
-            printf("  sub rax, rdi\n");
-            printf("  cqo\n");
-            printf("  mov rdi, %d\n", node->lhs->ty->base->size);
-            printf("  idiv rdi\n");
+        }
+        case IR_LOAD: {
+            Reg r = def_reg(d);
+            if (ir->size == 1)
+                emit(I_MOVSX, reg(r), deref(ir->a, 1));
+            else
+                emit(I_MOV, reg(r), deref(ir->a, 8));
+            def(d, r);
             break;
-        case ND_MUL:
-            printf("  imul rax, rdi\n");
+        }
+        case IR_STORE: {
+            Reg v = use_reg(ir->b, RDI);
+            if (ir->size == 1)
+                emit(I_MOV, deref(ir->a, 1), reg8(v));
+            else
+                emit(I_MOV, deref(ir->a, 8), reg(v));
             break;
-        case ND_DIV:
-            printf("  cqo\n");
-            printf("  idiv rdi\n");
+        }
+        case IR_STORE_ARG:
+            if (ir->size == 1) {
+                emit(I_MOV, mem(RBP, -ir->var->offset, 1), reg8(argreg[ir->imm]));
+            } else {
+                assert(ir->size == 8);
+                emit(I_MOV, mem(RBP, -ir->var->offset, 8), reg(argreg[ir->imm]));
+            }
             break;
-        case ND_EQ:
-            printf("  cmp rax, rdi\n");
-            printf("  sete al\n");
-            printf("  movzb rax, al\n");
+        case IR_CALL:
+            for (int i = 0; i < ir->nargs; i++)
+                load(argreg[i], ir->args[i]);
+            // フレームは16バイト境界に揃えてあり，本体では push しないので，
+            // ABI が求める RSP の揃えはいつも満たされている
+            emit(I_MOV, reg(RAX), imm(0));
+            emit1(I_CALL, label(ir->name));
+            def(d, RAX);
             break;
-        case ND_NE:
-            printf("  cmp rax, rdi\n");
-            printf("  setne al\n");
-            printf("  movzb rax, al\n");
+        case IR_BR:
+            if (locs[ir->a].kind == LOC_IMM) {
+                BB *bb = locs[ir->a].imm ? ir->then : ir->els;
+                if (bb != next)
+                    emit1(I_JMP, label(labels[bb->label]));
+                break;
+            }
+            emit(I_CMP, reg(use_reg(ir->a, RAX)), imm(0));
+            gen_jcc(CC_NE, ir->then, ir->els, next);
             break;
-        case ND_LT:
-            printf("  cmp rax, rdi\n");
-            printf("  setl al\n");
-            printf("  movzb rax, al\n");
+        case IR_JMP:
+            if (ir->then != next)
+                emit1(I_JMP, label(labels[ir->then->label]));
             break;
-        case ND_LE:
-            printf("  cmp rax, rdi\n");
-            printf("  setle al\n");
-            printf("  movzb rax, al\n");
+        case IR_RET:
+            load(RAX, ir->a);
+            // 最後のブロックからはエピローグに落ちる
+            if (next)
+                emit1(I_JMP, label(format(".L.return.%s", funcname)));
             break;
     }
+    return ir->next;
+}
 
-    printf("  push rax\n");
+int align_to(int n, int align) {
+    return (n + align - 1) & ~(align - 1);
 }
 
-static void emit_data(Program *prog) {
-    printf(".data\n");
+// Sets the stack offset of every local variable.
+void assign_lvar_offsets(Program *prog) {
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        int offset = 0;
+        for (VarList *vl = fn->locals; vl; vl = vl->next) {
+            Var *var = vl->var;
+            offset += var->ty->size;
+            var->offset = offset;
+        }
+        fn->stack_size = align_to(offset, 8);
+    }
+}
+
+// Returns the first block after bb that is emitted.
+static BB *next_reachable(BB *bb) {
+    for (bb = bb->next; bb; bb = bb->next)
+        if (reachable[bb->label])
+            return bb;
+    return NULL;
+}
 
-    for (VarList *vl = prog->globals; vl; vl = vl->next) {
-        Var *var = vl->var;
-        printf("%s:\n", var->name);
+// Returns the instructions for one function.
+static Insn *gen_func(Function *fn) {
+    Insn head = {};
+    out = &head;
+    insn_arena = &fn->arena;
+    funcname = fn->name;
 
-        if (!var->contents) {
-            printf("  .zero %d\n", var->ty->size);
-            continue;
-        }
+    IRFunc *f = gen_ir_func(fn);
+    fold_locs(f);
+    mark_reachable(f);
+    int nsaved;
+    int frame = regalloc(f, locs, reachable, fn->stack_size, &nsaved);
+    labels = arena_alloc(insn_arena, (f->nbb + 1) * sizeof(char *));
+    for (BB *bb = f->bbs; bb; bb = bb->next)
+        labels[bb->label] = format(".L.%s.%d", funcname, bb->label);
 
-        for (int i = 0; i < var->cont_len; i++)
-            printf("  .byte %d\n", var->contents[i]);
+    emit_label(fn->name)->global = true;
+
+    // プロローグ．使う callee-saved レジスタはスロットの下に退避する．
+    // フレームは16バイト境界に揃える
+    emit1(I_PUSH, reg(RBP));
+    emit(I_MOV, reg(RBP), reg(RSP));
+    emit(I_SUB, reg(RSP), imm(align_to(frame + nsaved * 8, 16)));
+    for (int i = 0; i < nsaved; i++)
+        emit(I_MOV, mem(RBP, -(frame + (i + 1) * 8), 8), reg(callee_saved[i]));
+
+    for (BB *bb = f->bbs; bb; bb = bb->next) {
+        if (!reachable[bb->label])
+            continue;
+        if (bb != f->bbs)
+            emit_label(labels[bb->label]);
+        BB *next = next_reachable(bb);
+        for (IR *ir = bb->ir; ir;)
+            ir = gen_insn(ir, next);
     }
+
+    // エピローグ
+    emit_label(format(".L.return.%s", funcname));
+    for (int i = 0; i < nsaved; i++)
+        emit(I_MOV, reg(callee_saved[i]), mem(RBP, -(frame + (i + 1) * 8), 8));
+    emit(I_MOV, reg(RSP), reg(RBP));
+    emit1(I_POP, reg(RBP));
+    emit0(I_RET);
+    return head.next;
 }
 
-static void load_arg(Var *var, int idx) {
-    int sz = var->ty->size;
-    if (sz == 1) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
-    } else {
-        assert(sz == 8);
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
-    }
+// キャッシュにあった関数は前回のアセンブリをそのまま使う
+static Insn *cached_func(Function *fn) {
+    Insn *insn = arena_alloc(&fn->arena, sizeof(Insn));
+    insn->kind = I_TEXT;
+    insn->text = fn->cached;
+    return insn;
 }
 
-static void emit_text(Program *prog) {
-    printf(".text\n");
+typedef struct {
+    Function **fns;
+    Insn **insns;
+    int nfns;
+    int next;      // 次に生成する関数の番号
+    CompileContext *ctx;
+} Work;
 
-    for (Function *fn = prog->fns; fn; fn = fn->next) {
-        printf(".global %s\n", fn->name);
-        printf("%s:\n", fn->name);
-        funcname = fn->name;
-
-        // プロローグ
-        printf("  push rbp\n");
-        printf("  mov rbp, rsp\n");
-        printf("  sub rsp, %d\n", fn->stack_size);
-
-        // 引数をスタックにpush
-        int i = 0;
-        for (VarList *vl = fn->params; vl; vl = vl->next)
-            load_arg(vl->var, i++);
-
-        // 抽象構文木をを降りながらコード生成
-        for (Node *node = fn->node; node; node = node->next)
-            gen(node);
-
-        // エピローグ
-        printf(".L.return.%s:\n", funcname);
-        printf("  mov rsp, rbp\n");
-        printf("  pop rbp\n");
-        printf("  ret\n");
+static void *worker(void *arg) {
+    Work *work = arg;
+    ctx = work->ctx;
+    for (;;) {
+        int i = __atomic_fetch_add(&work->next, 1, __ATOMIC_RELAXED);
+        if (i >= work->nfns)
+            return NULL;
+        Function *fn = work->fns[i];
+        work->insns[i] = fn->cached ? cached_func(fn) : gen_func(fn);
     }
 }
 
-void codegen(Program *prog) {
-    // アセンブリの前半部分を出力
-    printf(".intel_syntax noprefix\n");
-    emit_data(prog);
-    emit_text(prog);
+// Selects x86-64 instructions for every function in the program. The
+// result is rendered by emit_asm() or encoded by encode().
+//
+// Functions are independent of each other, so with ctx->opt_jobs > 1 they
+// are generated by a pool of threads. The per-function lists are joined
+// in source order, so the output does not depend on the scheduling.
+Insn *codegen(Program *prog) {
+    Work work = {.ctx = ctx};
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        // ワーカーが使う前に登録しておく
+        arena_register(&fn->arena);
+        work.nfns++;
+    }
+    // エラーで compile() に戻っても解放されるようアリーナから確保する
+    work.fns = arena_alloc(&ctx->parse_arena, work.nfns * sizeof(Function *));
+    work.insns = arena_alloc(&ctx->parse_arena, work.nfns * sizeof(Insn *));
+
+    int i = 0;
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+        work.fns[i++] = fn;
+
+    // エラーで戻れるのは compile() を呼んだスレッドだけなので，その中では
+    // 並列にしない
+    int nthreads = ctx->opt_jobs < work.nfns ? ctx->opt_jobs : work.nfns;
+    if (ctx->bailout)
+        nthreads = 1;
+    pthread_t *threads = arena_alloc(&ctx->parse_arena, nthreads * sizeof(pthread_t));
+    for (int i = 1; i < nthreads; i++)
+        if (pthread_create(&threads[i], NULL, worker, &work))
+            error("cannot create a thread");
+    worker(&work);
+    for (int i = 1; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+
+    Insn head = {};
+    Insn *cur = &head;
+    for (int i = 0; i < work.nfns; i++) {
+        cur->next = work.insns[i];
+        while (cur->next)
+            cur = cur->next;
+    }
+    return head.next;
 }
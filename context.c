@@ -0,0 +1,132 @@
+#include "9cc.h"
+#include <unistd.h>
+
+// コンパイラをライブラリとして使うための入り口．
+//
+// コンパイルの状態は全て CompileContext にあり，コンパイラの各部分は
+// 今のスレッドの ctx を通してそれを使う．スレッドごとに別のコンテキストを
+// 使えば，同時に何個でもコンパイルできる
+
+_Thread_local CompileContext *ctx;
+
+// Returns a new context. The options can be set in the returned object
+// before calling compile().
+CompileContext *context_new() {
+    CompileContext *c = calloc(1, sizeof(CompileContext));
+    c->atom_arena.name = "intern";
+    c->parse_arena.name = "parse";
+    c->type_arena.name = "type";
+    c->arenas_last = &c->arenas;
+    c->opt_jobs = 1;
+    c->lex_chunk_size = 256 * 1024;
+    c->atom_map.arena = &c->atom_arena;
+    c->output.fd = STDOUT_FILENO;
+    c->output.path = "<stdout>";
+    return c;
+}
+
+// Frees everything the last compilation made and prepares the context
+// for the next one. Options are kept, and so are the token arrays and
+// the output buffer, so that they need not grow again.
+void context_reset(CompileContext *c) {
+    CompileContext *saved = ctx;
+    ctx = c;
+    arena_release_all();
+    ctx = saved;
+
+    c->filename = NULL;
+    free(c->srcbuf);
+    c->srcbuf = c->user_input = NULL;
+
+    TokenArray *ts = &c->tokens;
+    ts->size = ts->nstrs = ts->strbuf_len = 0;
+    c->token = 0;
+
+    // atom の綴りとハッシュ表のバケットは atom_arena にあった
+    c->atom_map = (HashMap){.arena = &c->atom_arena};
+    c->natoms = 0;
+
+    c->locals = c->globals = NULL;
+    c->scope = NULL;
+    c->var_map = (HashMap){};
+    c->node_arena = NULL;
+    c->nlabels = 0;
+
+    c->output.len = 0;
+    c->output.total = 0;
+    c->output.capturing = false;
+    c->counts = (Counts){};
+    c->stats.nphases = 0;
+    c->stats.cur = NULL;
+
+    for (int i = 0; i < c->ndiags; i++)
+        free(c->diags[i].message);
+    free(c->diags);
+    c->diags = NULL;
+    c->ndiags = 0;
+}
+
+// Releases the context and everything in it.
+void context_free(CompileContext *c) {
+    context_reset(c);
+    free_tokens(&c->tokens);
+    free(c->atoms);
+    free(c->output.buf);
+    free(c->output.capbuf);
+    if (ctx == c)
+        ctx = NULL;
+    free(c);
+}
+
+// Compiles src[0..len) to assembly on the calling thread. filename is
+// only used in diagnostics. Returns 0 on success; the assembly is then
+// in c->output.buf[0..c->output.len). On an error, returns 1 and the
+// error is in c->diags. Either stays valid until the next compile(),
+// context_reset() or context_free() on the same context.
+int compile(CompileContext *c, char *filename, char *src, size_t len) {
+    context_reset(c);
+    CompileContext *saved = ctx;
+    ctx = c;
+
+    c->filename = arena_strndup(&c->parse_arena, filename, strlen(filename));
+
+    // read_file() と同じく "\n\0" で終わるようにする．字句解析のベクトル
+    // 命令は '\0' を含む32バイトのブロックを丸ごと読むので，その分も確保する
+    size_t size = (len + 2 + 31) & ~(size_t)31;
+    c->srcbuf = aligned_alloc(32, size);
+    memset(c->srcbuf + len, 0, size - len);
+    memcpy(c->srcbuf, src, len);
+    if (len == 0 || src[len - 1] != '\n')
+        c->srcbuf[len++] = '\n';
+    c->srcbuf[len] = '\0';
+    c->user_input = c->srcbuf;
+
+    jmp_buf env;
+    c->bailout = &env;
+    int ret = 0;
+
+    if (setjmp(env)) {
+        ret = 1;
+    } else {
+        scan_init(NULL);
+        c->token = tokenize();
+        Program *prog = program();
+        fold(prog);
+        if (c->cache_dir)
+            cache_lookup(prog);
+        if (c->opt_level >= 1)
+            inline_functions(prog);
+        assign_lvar_offsets(prog);
+
+        Insn *insns = codegen(prog);
+        if (c->opt_level >= 1)
+            insns = peephole(insns);
+
+        out_open_mem();
+        emit_asm(prog, insns);
+    }
+
+    c->bailout = NULL;
+    ctx = saved;
+    return ret;
+}
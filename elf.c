@@ -0,0 +1,216 @@
+#include "9cc.h"
+#include <elf.h>
+
+// セクション番号
+enum {
+    SEC_NULL,
+    SEC_TEXT,
+    SEC_DATA,
+    SEC_RELA_TEXT,
+    SEC_SYMTAB,
+    SEC_STRTAB,
+    SEC_SHSTRTAB,
+    SEC_NOTE_GNU_STACK,
+    NUM_SECTIONS,
+};
+
+// 書き出し途中のバイト列
+typedef struct {
+    char *buf;
+    int len;
+    int cap;
+} Bytes;
+
+static void append(Bytes *b, void *p, int len) {
+    while (b->len + len > b->cap) {
+        b->cap = b->cap ? b->cap * 2 : 256;
+        b->buf = realloc(b->buf, b->cap);
+    }
+    memcpy(b->buf + b->len, p, len);
+    b->len += len;
+}
+
+static int append_str(Bytes *b, char *s) {
+    int offset = b->len;
+    append(b, s, strlen(s) + 1);
+    return offset;
+}
+
+static void align(Bytes *b, int n) {
+    static char zero[16];
+    append(b, zero, align_to(b->len, n) - b->len);
+}
+
+static Bytes symtab;
+static Bytes strtab;
+static Bytes rela;
+static int nsyms;
+
+// .data 上の変数 (名前 -> Var)
+static HashMap data_vars;
+// 未定義シンボル (名前 -> シンボル番号 + 1)
+static HashMap undef_syms;
+
+static int add_sym(char *name, int bind, int type, int shndx, long value, long size) {
+    Elf64_Sym sym = {
+        .st_name = name ? append_str(&strtab, name) : 0,
+        .st_info = ELF64_ST_INFO(bind, type),
+        .st_shndx = shndx,
+        .st_value = value,
+        .st_size = size,
+    };
+    append(&symtab, &sym, sizeof(sym));
+    return nsyms++;
+}
+
+static void build_symtab(Program *prog) {
+    append_str(&strtab, "");
+    add_sym(NULL, STB_LOCAL, STT_NOTYPE, SHN_UNDEF, 0, 0);
+    add_sym(NULL, STB_LOCAL, STT_SECTION, SEC_TEXT, 0, 0);
+    add_sym(NULL, STB_LOCAL, STT_SECTION, SEC_DATA, 0, 0);
+
+    // アセンブラと同じく .L で始まるラベルはシンボルテーブルに載せない
+    for (VarList *vl = prog->globals; vl; vl = vl->next) {
+        Var *var = vl->var;
+        if (strncmp(var->name, ".L", 2))
+            add_sym(var->name, STB_LOCAL, STT_OBJECT, SEC_DATA, var->offset, var->ty->size);
+    }
+}
+
+// Returns the symbol index for the given relocation target.
+static int reloc_sym(Reloc *rel, long *addend) {
+    if (rel->kind == R_ABS32S) {
+        Var *var = hashmap_get(&data_vars, rel->name);
+        if (!var)
+            error("internal error: undefined symbol %s", rel->name);
+        *addend = var->offset;
+        return 2; // .data のセクションシンボル
+    }
+
+    *addend = -4;
+    intptr_t idx = (intptr_t)hashmap_get(&undef_syms, rel->name);
+    if (!idx) {
+        idx = add_sym(rel->name, STB_GLOBAL, STT_NOTYPE, SHN_UNDEF, 0, 0) + 1;
+        hashmap_put(&undef_syms, rel->name, (void *)idx);
+    }
+    return idx - 1;
+}
+
+static void build_rela(MachineCode *mc) {
+    for (Reloc *rel = mc->relocs; rel; rel = rel->next) {
+        long addend;
+        int sym = reloc_sym(rel, &addend);
+        int type = (rel->kind == R_ABS32S) ? R_X86_64_32S : R_X86_64_PLT32;
+        Elf64_Rela r = {
+            .r_offset = rel->offset,
+            .r_info = ELF64_R_INFO(sym, type),
+            .r_addend = addend,
+        };
+        append(&rela, &r, sizeof(r));
+    }
+}
+
+// Writes a relocatable ELF object containing the encoded .text and the
+// program's global variables in .data.
+void emit_elf(Program *prog, MachineCode *mc) {
+    symtab = strtab = rela = (Bytes){};
+    data_vars = undef_syms = (HashMap){};
+    nsyms = 0;
+
+    int data_len;
+    unsigned char *data = layout_data(prog, &data_len, &data_vars);
+    build_symtab(prog);
+
+    // ローカルシンボルの後に大域シンボルを並べる
+    int first_global = nsyms;
+    for (TextSym *sym = mc->syms; sym; sym = sym->next)
+        add_sym(sym->name, STB_GLOBAL, STT_FUNC, SEC_TEXT, sym->offset, sym->size);
+    build_rela(mc);
+
+    Bytes shstrtab = {};
+    append_str(&shstrtab, "");
+    int name_text = append_str(&shstrtab, ".text");
+    int name_data = append_str(&shstrtab, ".data");
+    int name_rela = append_str(&shstrtab, ".rela.text");
+    int name_symtab = append_str(&shstrtab, ".symtab");
+    int name_strtab = append_str(&shstrtab, ".strtab");
+    int name_shstrtab = append_str(&shstrtab, ".shstrtab");
+    int name_note = append_str(&shstrtab, ".note.GNU-stack");
+
+    // ファイルの中身を組み立てる
+    Bytes file = {};
+    Elf64_Ehdr ehdr = {};
+    append(&file, &ehdr, sizeof(ehdr));
+
+    Elf64_Shdr sh[NUM_SECTIONS] = {};
+
+    align(&file, 16);
+    sh[SEC_TEXT] = (Elf64_Shdr){
+        .sh_name = name_text, .sh_type = SHT_PROGBITS,
+        .sh_flags = SHF_ALLOC | SHF_EXECINSTR,
+        .sh_offset = file.len, .sh_size = mc->len, .sh_addralign = 16,
+    };
+    append(&file, mc->buf, mc->len);
+
+    sh[SEC_DATA] = (Elf64_Shdr){
+        .sh_name = name_data, .sh_type = SHT_PROGBITS,
+        .sh_flags = SHF_ALLOC | SHF_WRITE,
+        .sh_offset = file.len, .sh_size = data_len, .sh_addralign = 1,
+    };
+    append(&file, data, data_len);
+
+    align(&file, 8);
+    sh[SEC_RELA_TEXT] = (Elf64_Shdr){
+        .sh_name = name_rela, .sh_type = SHT_RELA, .sh_flags = SHF_INFO_LINK,
+        .sh_offset = file.len, .sh_size = rela.len,
+        .sh_link = SEC_SYMTAB, .sh_info = SEC_TEXT,
+        .sh_addralign = 8, .sh_entsize = sizeof(Elf64_Rela),
+    };
+    append(&file, rela.buf, rela.len);
+
+    sh[SEC_SYMTAB] = (Elf64_Shdr){
+        .sh_name = name_symtab, .sh_type = SHT_SYMTAB,
+        .sh_offset = file.len, .sh_size = symtab.len,
+        .sh_link = SEC_STRTAB, .sh_info = first_global,
+        .sh_addralign = 8, .sh_entsize = sizeof(Elf64_Sym),
+    };
+    append(&file, symtab.buf, symtab.len);
+
+    sh[SEC_STRTAB] = (Elf64_Shdr){
+        .sh_name = name_strtab, .sh_type = SHT_STRTAB,
+        .sh_offset = file.len, .sh_size = strtab.len, .sh_addralign = 1,
+    };
+    append(&file, strtab.buf, strtab.len);
+
+    sh[SEC_SHSTRTAB] = (Elf64_Shdr){
+        .sh_name = name_shstrtab, .sh_type = SHT_STRTAB,
+        .sh_offset = file.len, .sh_size = shstrtab.len, .sh_addralign = 1,
+    };
+    append(&file, shstrtab.buf, shstrtab.len);
+
+    sh[SEC_NOTE_GNU_STACK] = (Elf64_Shdr){
+        .sh_name = name_note, .sh_type = SHT_PROGBITS,
+        .sh_offset = file.len, .sh_addralign = 1,
+    };
+
+    align(&file, 8);
+    int shoff = file.len;
+    append(&file, sh, sizeof(sh));
+
+    Elf64_Ehdr *eh = (Elf64_Ehdr *)file.buf;
+    memcpy(eh->e_ident, ELFMAG, SELFMAG);
+    eh->e_ident[EI_CLASS] = ELFCLASS64;
+    eh->e_ident[EI_DATA] = ELFDATA2LSB;
+    eh->e_ident[EI_VERSION] = EV_CURRENT;
+    eh->e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    eh->e_type = ET_REL;
+    eh->e_machine = EM_X86_64;
+    eh->e_version = EV_CURRENT;
+    eh->e_shoff = shoff;
+    eh->e_ehsize = sizeof(Elf64_Ehdr);
+    eh->e_shentsize = sizeof(Elf64_Shdr);
+    eh->e_shnum = NUM_SECTIONS;
+    eh->e_shstrndx = SEC_SHSTRTAB;
+
+    out_write(file.buf, file.len);
+}
@@ -0,0 +1,161 @@
+#include "9cc.h"
+
+static bool is_num(Node *node) {
+    return node && node->kind == ND_NUM;
+}
+
+static bool fits_int(long val) {
+    return INT_MIN <= val && val <= INT_MAX;
+}
+
+// Returns n if val == 2^n, or -1 otherwise.
+static int log2_exact(long val) {
+    if (val <= 0 || (val & (val - 1)))
+        return -1;
+    int n = 0;
+    while (val > 1) {
+        val >>= 1;
+        n++;
+    }
+    return n;
+}
+
+static void to_num(Node *node, long val) {
+    node->kind = ND_NUM;
+    node->val = val;
+    node->lhs = NULL;
+    node->rhs = NULL;
+}
+
+// Replaces node with one of its operands. The node keeps its place in
+// the statement list and its type.
+static void replace_with(Node *node, Node *operand) {
+    Node *next = node->next;
+    Type *ty = node->ty;
+    *node = *operand;
+    node->next = next;
+    node->ty = ty;
+}
+
+// 定数同士の演算を評価する．評価できなければ false を返す
+static bool eval_binary(NodeKind kind, long lhs, long rhs, long *val) {
+    switch (kind) {
+        case ND_ADD: *val = lhs + rhs; break;
+        case ND_SUB: *val = lhs - rhs; break;
+        case ND_MUL: *val = lhs * rhs; break;
+        case ND_DIV:
+            if (rhs == 0)
+                return false;
+            *val = lhs / rhs;
+            break;
+        case ND_EQ: *val = lhs == rhs; break;
+        case ND_NE: *val = lhs != rhs; break;
+        case ND_LT: *val = lhs < rhs; break;
+        case ND_LE: *val = lhs <= rhs; break;
+        default:
+            return false;
+    }
+    return fits_int(*val);
+}
+
+// x * 2^n を x << n に置き換える
+static bool to_shift(Node *node, Node *x, Node *num) {
+    int n = log2_exact(num->val);
+    if (n <= 0)
+        return false;
+    node->kind = ND_SHL;
+    node->lhs = x;
+    node->rhs = num;
+    num->val = n;
+    return true;
+}
+
+static void fold_node(Node *node);
+
+static void fold_list(Node *node) {
+    for (; node; node = node->next)
+        fold_node(node);
+}
+
+static void fold_node(Node *node) {
+    if (!node)
+        return;
+
+    fold_node(node->lhs);
+    fold_node(node->rhs);
+    fold_node(node->cond);
+    fold_node(node->then);
+    fold_node(node->els);
+    fold_node(node->init);
+    fold_node(node->inc);
+    fold_list(node->body);
+    fold_list(node->args);
+
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+    long val;
+
+    switch (node->kind) {
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_EQ:
+        case ND_NE:
+        case ND_LT:
+        case ND_LE:
+            if (is_num(lhs) && is_num(rhs) && eval_binary(node->kind, lhs->val, rhs->val, &val)) {
+                to_num(node, val);
+                return;
+            }
+            break;
+        case ND_PTR_ADD:
+        case ND_PTR_SUB:
+            // 定数オフセットは要素サイズを掛けた値に前もって変換しておく
+            if (lhs->ty->base && is_num(rhs) && fits_int((long)rhs->val * lhs->ty->base->size)) {
+                rhs->val *= lhs->ty->base->size;
+                node->kind = (node->kind == ND_PTR_ADD) ? ND_ADD : ND_SUB;
+                if (rhs->val == 0)
+                    replace_with(node, lhs);
+                return;
+            }
+            return;
+        default:
+            return;
+    }
+
+    // Algebraic identities with one constant operand
+    switch (node->kind) {
+        case ND_ADD:
+            if (is_num(rhs) && rhs->val == 0)
+                replace_with(node, lhs);
+            else if (is_num(lhs) && lhs->val == 0)
+                replace_with(node, rhs);
+            return;
+        case ND_SUB:
+            if (is_num(rhs) && rhs->val == 0)
+                replace_with(node, lhs);
+            return;
+        case ND_MUL:
+            if (is_num(rhs) && rhs->val == 1)
+                replace_with(node, lhs);
+            else if (is_num(lhs) && lhs->val == 1)
+                replace_with(node, rhs);
+            else if (is_num(rhs) && to_shift(node, lhs, rhs))
+                ;
+            else if (is_num(lhs))
+                to_shift(node, rhs, lhs);
+            return;
+        case ND_DIV:
+            if (is_num(rhs) && rhs->val == 1)
+                replace_with(node, lhs);
+            return;
+    }
+}
+
+// Folds constant subexpressions and simplifies arithmetic identities.
+// Runs on typed ASTs, so every node keeps the type add_type() gave it.
+void fold(Program *prog) {
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+        fold_list(fn->node);
+}
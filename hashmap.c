@@ -0,0 +1,117 @@
+#include "9cc.h"
+
+// 使用率がこれを超えたらバケットを倍に広げる (%)
+#define HIGH_WATERMARK 70
+
+#define INIT_SIZE 16
+
+static uint64_t fnv_hash(char *s, int len) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (int i = 0; i < len; i++) {
+        hash *= 0x100000001b3;
+        hash ^= (unsigned char)s[i];
+    }
+    return hash;
+}
+
+static bool match(HashEntry *ent, char *key, int keylen) {
+    return ent->key && ent->keylen == keylen && !memcmp(ent->key, key, keylen);
+}
+
+static void rehash(HashMap *map) {
+    int cap = map->capacity ? map->capacity * 2 : INIT_SIZE;
+    HashMap map2 = {.capacity = cap, .arena = map->arena};
+    if (map->arena)
+        map2.buckets = arena_alloc(map->arena, cap * sizeof(HashEntry));
+    else
+        map2.buckets = calloc(cap, sizeof(HashEntry));
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[i];
+        if (ent->key)
+            hashmap_put2(&map2, ent->key, ent->keylen, ent->val);
+    }
+
+    if (!map->arena)
+        free(map->buckets);
+    *map = map2;
+}
+
+static HashEntry *get_entry(HashMap *map, char *key, int keylen) {
+    if (!map->buckets)
+        return NULL;
+
+    uint64_t hash = fnv_hash(key, keylen);
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+        if (match(ent, key, keylen))
+            return ent;
+        if (!ent->key)
+            return NULL;
+    }
+    return NULL;
+}
+
+static HashEntry *get_or_insert_entry(HashMap *map, char *key, int keylen) {
+    if (map->used * 100 >= map->capacity * HIGH_WATERMARK)
+        rehash(map);
+
+    uint64_t hash = fnv_hash(key, keylen);
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+        if (match(ent, key, keylen))
+            return ent;
+        if (!ent->key) {
+            ent->key = key;
+            ent->keylen = keylen;
+            map->used++;
+            return ent;
+        }
+    }
+    unreachable();
+}
+
+void *hashmap_get(HashMap *map, char *key) {
+    return hashmap_get2(map, key, strlen(key));
+}
+
+void *hashmap_get2(HashMap *map, char *key, int keylen) {
+    HashEntry *ent = get_entry(map, key, keylen);
+    return ent ? ent->val : NULL;
+}
+
+void hashmap_put(HashMap *map, char *key, void *val) {
+    hashmap_put2(map, key, strlen(key), val);
+}
+
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val) {
+    get_or_insert_entry(map, key, keylen)->val = val;
+}
+
+// Returns the number of the canonical copy of the given string. Atoms
+// are numbered from 0 in the order they are first interned, so tokens
+// can refer to them with a 32-bit index.
+int intern_id(char *s, int len) {
+    CompileContext *c = ctx;
+
+    // 値には番号 + 1 を入れる．0 (NULL) は登録されていないことを表す
+    intptr_t id = (intptr_t)hashmap_get2(&c->atom_map, s, len);
+    if (id)
+        return id - 1;
+
+    if (c->natoms == c->atoms_capacity) {
+        c->atoms_capacity = c->atoms_capacity ? c->atoms_capacity * 2 : 256;
+        c->atoms = realloc(c->atoms, c->atoms_capacity * sizeof(char *));
+    }
+
+    char *p = arena_strndup(&c->atom_arena, s, len);
+    c->atoms[c->natoms] = p;
+    hashmap_put2(&c->atom_map, p, len, (void *)(c->natoms + 1L));
+    return c->natoms++;
+}
+
+// Returns a canonical copy of the given string. Equal strings are
+// interned to the same pointer, so they can be compared with ==.
+char *intern(char *s, int len) {
+    return ctx->atoms[intern_id(s, len)];
+}
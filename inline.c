@@ -0,0 +1,269 @@
+#include "9cc.h"
+
+// 呼び出しを本体で置き換える関数の大きさ (ASTノード数) の上限
+#define INLINE_MAX_NODES 24
+
+// 関数ごとのインライン展開の可否
+typedef struct {
+    Function *fn;
+    char *reason;  // 展開できない理由．展開できるなら NULL
+    int size;      // ノード数
+    Node *ret;     // 値を返す return 文
+} Callee;
+
+// 展開先の関数とその中での変数の対応
+static _Thread_local Function *caller;
+static _Thread_local VarList *callee_vars;
+static _Thread_local VarList *clone_vars;
+
+static int count_nodes(Node *node);
+
+static int count_list(Node *node) {
+    int n = 0;
+    for (; node; node = node->next)
+        n += count_nodes(node);
+    return n;
+}
+
+static int count_nodes(Node *node) {
+    if (!node)
+        return 0;
+    return 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+           count_nodes(node->cond) + count_nodes(node->then) +
+           count_nodes(node->els) + count_nodes(node->init) +
+           count_nodes(node->inc) + count_list(node->body) +
+           count_list(node->args);
+}
+
+// Returns true if the subtree contains a node of the given kind.
+static bool contains(Node *node, NodeKind kind);
+
+static bool list_contains(Node *node, NodeKind kind) {
+    for (; node; node = node->next)
+        if (contains(node, kind))
+            return true;
+    return false;
+}
+
+static bool contains(Node *node, NodeKind kind) {
+    if (!node)
+        return false;
+    return node->kind == kind ||
+           contains(node->lhs, kind) || contains(node->rhs, kind) ||
+           contains(node->cond, kind) || contains(node->then, kind) ||
+           contains(node->els, kind) || contains(node->init, kind) ||
+           contains(node->inc, kind) || list_contains(node->body, kind) ||
+           list_contains(node->args, kind);
+}
+
+// 展開できるのは他の関数を呼ばず，関数本体の直下の return で値を返す
+// 関数だけ．return より後ろの文は実行されないので無視する
+static Callee *analyze(Function *fn) {
+    Callee *c = arena_alloc(&ctx->parse_arena, sizeof(Callee));
+    c->fn = fn;
+
+    Node *node = fn->node;
+    for (; node && node->kind != ND_RETURN; node = node->next) {
+        if (contains(node, ND_RETURN)) {
+            c->reason = "return inside a statement";
+            return c;
+        }
+        c->size += count_nodes(node);
+    }
+
+    if (!node) {
+        c->reason = "no return statement";
+        return c;
+    }
+    c->ret = node;
+    c->size += count_nodes(node);
+
+    if (list_contains(fn->node, ND_FUNCALL))
+        c->reason = "calls a function";
+    else if (c->size > INLINE_MAX_NODES)
+        c->reason = "too large";
+    return c;
+}
+
+static Var *remap(Var *var) {
+    if (!var || !var->is_local)
+        return var;
+    for (VarList *a = callee_vars, *b = clone_vars; a; a = a->next, b = b->next)
+        if (a->var == var)
+            return b->var;
+    unreachable();
+}
+
+static Node *clone(Node *node);
+
+static Node *clone_list(Node *node) {
+    Node head = {};
+    Node *cur = &head;
+    for (; node; node = node->next)
+        cur = cur->next = clone(node);
+    return head.next;
+}
+
+// Copies a callee subtree into the caller's arena, replacing the
+// callee's local variables with their copies.
+static Node *clone(Node *node) {
+    if (!node)
+        return NULL;
+
+    Node *n = arena_alloc(&caller->arena, sizeof(Node));
+    ctx->counts.nodes++;
+    *n = *node;
+    n->next = NULL;
+    n->lhs = clone(node->lhs);
+    n->rhs = clone(node->rhs);
+    n->cond = clone(node->cond);
+    n->then = clone(node->then);
+    n->els = clone(node->els);
+    n->init = clone(node->init);
+    n->inc = clone(node->inc);
+    n->body = clone_list(node->body);
+    n->args = clone_list(node->args);
+    n->var = remap(node->var);
+    return n;
+}
+
+static Node *new_node(NodeKind kind, Type *ty, Token tok) {
+    Node *node = arena_alloc(&caller->arena, sizeof(Node));
+    ctx->counts.nodes++;
+    node->kind = kind;
+    node->ty = ty;
+    node->tok = tok;
+    return node;
+}
+
+// Gives every local variable of the callee a fresh copy in the caller.
+static void clone_locals(Function *fn) {
+    callee_vars = fn->locals;
+    clone_vars = NULL;
+
+    VarList head = {};
+    VarList *cur = &head;
+    for (VarList *vl = fn->locals; vl; vl = vl->next) {
+        Var *var = arena_alloc(&caller->arena, sizeof(Var));
+        ctx->counts.vars++;
+        *var = *vl->var;
+
+        cur = cur->next = arena_alloc(&caller->arena, sizeof(VarList));
+        cur->var = var;
+
+        VarList *local = arena_alloc(&caller->arena, sizeof(VarList));
+        local->var = var;
+        local->next = caller->locals;
+        caller->locals = local;
+    }
+    clone_vars = head.next;
+}
+
+// Rewrites the call into a statement expression
+//
+//   ({ param1 = arg1; ...; stmt1; ...; return-value; })
+//
+// The arguments are assigned in the order codegen evaluates them.
+static void expand(Node *call, Callee *c) {
+    clone_locals(c->fn);
+
+    Node head = {};
+    Node *cur = &head;
+
+    Node *arg = call->args;
+    for (VarList *vl = c->fn->params; vl; vl = vl->next) {
+        Node *next = arg->next;
+        arg->next = NULL;
+
+        Var *param = remap(vl->var);
+        Node *var = new_node(ND_VAR, param->ty, call->tok);
+        var->var = param;
+        Node *assign = new_node(ND_ASSIGN, param->ty, call->tok);
+        assign->lhs = var;
+        assign->rhs = arg;
+        cur = cur->next = new_node(ND_EXPR_STMT, NULL, call->tok);
+        cur->lhs = assign;
+
+        arg = next;
+    }
+
+    for (Node *node = c->fn->node; node != c->ret; node = node->next)
+        cur = cur->next = clone(node);
+    cur = cur->next = clone(c->ret->lhs);
+
+    call->kind = ND_STMT_EXPR;
+    call->body = head.next;
+    call->args = NULL;
+    call->funcname = NULL;
+}
+
+static int count_args(Node *node) {
+    int n = 0;
+    for (Node *arg = node->args; arg; arg = arg->next)
+        n++;
+    return n;
+}
+
+static int count_params(Function *fn) {
+    int n = 0;
+    for (VarList *vl = fn->params; vl; vl = vl->next)
+        n++;
+    return n;
+}
+
+static void inline_node(HashMap *callees, Node *node);
+
+static void inline_list(HashMap *callees, Node *node) {
+    for (; node; node = node->next)
+        inline_node(callees, node);
+}
+
+static void inline_node(HashMap *callees, Node *node) {
+    if (!node)
+        return;
+
+    inline_node(callees, node->lhs);
+    inline_node(callees, node->rhs);
+    inline_node(callees, node->cond);
+    inline_node(callees, node->then);
+    inline_node(callees, node->els);
+    inline_node(callees, node->init);
+    inline_node(callees, node->inc);
+    inline_list(callees, node->body);
+    inline_list(callees, node->args);
+
+    if (node->kind != ND_FUNCALL)
+        return;
+
+    Callee *c = hashmap_get(callees, node->funcname);
+    if (!c)
+        return;
+
+    char *reason = c->reason;
+    if (!reason && count_args(node) != count_params(c->fn))
+        reason = "argument count mismatch";
+
+    if (ctx->opt_inline_report) {
+        if (reason)
+            fprintf(stderr, "%s: not inlining %s: %s\n", caller->name, c->fn->name, reason);
+        else
+            fprintf(stderr, "%s: inlining %s (%d nodes)\n", caller->name, c->fn->name, c->size);
+    }
+
+    if (!reason)
+        expand(node, c);
+}
+
+// Replaces calls to small leaf functions with copies of their bodies.
+// Must run before stack offsets are assigned, since inlining adds local
+// variables to the caller.
+void inline_functions(Program *prog) {
+    HashMap callees = {.arena = &ctx->parse_arena};
+    for (Function *fn = prog->fns; fn; fn = fn->next)
+        hashmap_put(&callees, fn->name, analyze(fn));
+
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        caller = fn;
+        inline_list(&callees, fn->node);
+    }
+}
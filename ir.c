@@ -0,0 +1,435 @@
+#include "9cc.h"
+
+// AST を基本ブロックと三番地コードに下ろす．codegen.c はこの IR から
+// 命令を選び，--dump-ir はこれをそのまま出力する
+
+// 現在 IR を組み立てている関数と基本ブロック．関数ごとに別のスレッドで
+// 組み立てるので，スレッドごとに持つ
+static _Thread_local IRFunc *fn;
+static _Thread_local BB *out;
+// IR の確保先．組み立て中の関数のアリーナ
+static _Thread_local Arena *ir_arena;
+
+static BB *new_bb() {
+    return arena_alloc(ir_arena, sizeof(BB));
+}
+
+// Appends a basic block to the current function and makes it the
+// insertion point for subsequent instructions.
+static void start_bb(BB *bb) {
+    bb->label = ++fn->nbb;
+    // 挿入点は常に最後のブロックなので，その後ろにつなぐ
+    if (!fn->bbs)
+        fn->bbs = bb;
+    else
+        out->next = bb;
+    out = bb;
+}
+
+static int new_reg() {
+    return ++fn->nreg;
+}
+
+static IR *emit(IROp op, int dst, int a, int b) {
+    IR *ir = arena_alloc(ir_arena, sizeof(IR));
+    ir->op = op;
+    ir->dst = dst;
+    ir->a = a;
+    ir->b = b;
+
+    if (!out->ir)
+        out->ir = ir;
+    else
+        out->last->next = ir;
+    out->last = ir;
+    return ir;
+}
+
+static int emit_imm(long val) {
+    int r = new_reg();
+    emit(IR_IMM, r, 0, 0)->imm = val;
+    return r;
+}
+
+static void emit_jmp(BB *bb) {
+    emit(IR_JMP, 0, 0, 0)->then = bb;
+}
+
+static void emit_br(int cond, BB *then, BB *els) {
+    IR *ir = emit(IR_BR, 0, cond, 0);
+    ir->then = then;
+    ir->els = els;
+}
+
+static int gen_expr(Node *node);
+static void gen_stmt(Node *node);
+
+// Computes the given node's address into a new register.
+static int gen_lval(Node *node) {
+    switch (node->kind) {
+        case ND_VAR: {
+            int r = new_reg();
+            emit(IR_ADDR, r, 0, 0)->var = node->var;
+            return r;
+        }
+        case ND_MEMBER: {
+            int r = new_reg();
+            emit(IR_ADD, r, gen_lval(node->lhs), emit_imm(node->member->offset));
+            return r;
+        }
+        case ND_DEREF:
+            return gen_expr(node->lhs);
+    }
+
+    error_tok(node->tok, "Not an lvalue");
+}
+
+static int load(Type *ty, int addr) {
+    if (ty->kind == TY_ARRAY)
+        return addr;
+    int r = new_reg();
+    emit(IR_LOAD, r, addr, 0)->size = ty->size;
+    return r;
+}
+
+static int gen_binop(IROp op, Node *node) {
+    int a = gen_expr(node->lhs);
+    int b = gen_expr(node->rhs);
+    int r = new_reg();
+    emit(op, r, a, b);
+    return r;
+}
+
+// Pointer arithmetic is lowered into explicit scaling by the element size.
+static int gen_scaled(IROp op, Node *node) {
+    int a = gen_expr(node->lhs);
+    int b = gen_expr(node->rhs);
+    int size = emit_imm(node->ty->base->size);
+    int scaled = new_reg();
+    emit(IR_MUL, scaled, b, size);
+    int r = new_reg();
+    emit(op, r, a, scaled);
+    return r;
+}
+
+static int gen_expr(Node *node) {
+    switch (node->kind) {
+        case ND_NUM:
+            return emit_imm(node->val);
+        case ND_VAR:
+        case ND_MEMBER:
+            return load(node->ty, gen_lval(node));
+        case ND_ADDR:
+            return gen_lval(node->lhs);
+        case ND_DEREF:
+            return load(node->ty, gen_expr(node->lhs));
+        case ND_ASSIGN: {
+            if (node->lhs->ty->kind == TY_ARRAY)
+                error_tok(node->lhs->tok, "not an lvalue");
+            int addr = gen_lval(node->lhs);
+            int val = gen_expr(node->rhs);
+            emit(IR_STORE, 0, addr, val)->size = node->ty->size;
+            return val;
+        }
+        case ND_STMT_EXPR: {
+            // 最後の式の値が文式の値になる
+            Node *n = node->body;
+            for (; n->next; n = n->next)
+                gen_stmt(n);
+            return gen_expr(n);
+        }
+        case ND_FUNCALL: {
+            int args[MAX_ARGS];
+            int nargs = 0;
+            for (Node *arg = node->args; arg; arg = arg->next) {
+                if (nargs == MAX_ARGS)
+                    error_tok(arg->tok, "too many arguments");
+                args[nargs++] = gen_expr(arg);
+            }
+
+            int r = new_reg();
+            IR *ir = emit(IR_CALL, r, 0, 0);
+            ir->name = node->funcname;
+            ir->nargs = nargs;
+            memcpy(ir->args, args, sizeof(args));
+            return r;
+        }
+        case ND_ADD:
+            return gen_binop(IR_ADD, node);
+        case ND_SUB:
+            return gen_binop(IR_SUB, node);
+        case ND_MUL:
+            return gen_binop(IR_MUL, node);
+        case ND_DIV:
+            return gen_binop(IR_DIV, node);
+        case ND_SHL:
+            return gen_binop(IR_SHL, node);
+        case ND_EQ:
+            return gen_binop(IR_EQ, node);
+        case ND_NE:
+            return gen_binop(IR_NE, node);
+        case ND_LT:
+            return gen_binop(IR_LT, node);
+        case ND_LE:
+            return gen_binop(IR_LE, node);
+        case ND_PTR_ADD:
+            return gen_scaled(IR_ADD, node);
+        case ND_PTR_SUB:
+            return gen_scaled(IR_SUB, node);
+        case ND_PTR_DIFF: {
+            int diff = gen_binop(IR_SUB, node);
+            int size = emit_imm(node->lhs->ty->base->size);
+            int r = new_reg();
+            emit(IR_DIV, r, diff, size);
+            return r;
+        }
+    }
+
+    error_tok(node->tok, "invalid expression");
+}
+
+static void gen_stmt(Node *node) {
+    switch (node->kind) {
+        case ND_NULL:
+            return;
+        case ND_EXPR_STMT:
+            gen_expr(node->lhs);
+            return;
+        case ND_RETURN:
+            emit(IR_RET, 0, gen_expr(node->lhs), 0);
+            // return の後ろのコードは到達不能だが，ブロックは閉じておく
+            start_bb(new_bb());
+            return;
+        case ND_IF: {
+            BB *then = new_bb();
+            BB *els = new_bb();
+            BB *end = node->els ? new_bb() : els;
+
+            emit_br(gen_expr(node->cond), then, els);
+            start_bb(then);
+            gen_stmt(node->then);
+            emit_jmp(end);
+            if (node->els) {
+                start_bb(els);
+                gen_stmt(node->els);
+                emit_jmp(end);
+            }
+            start_bb(end);
+            return;
+        }
+        case ND_WHILE:
+        case ND_FOR: {
+            BB *cond = new_bb();
+            BB *body = new_bb();
+            BB *end = new_bb();
+
+            if (node->init)
+                gen_stmt(node->init);
+            emit_jmp(cond);
+            start_bb(cond);
+            if (node->cond)
+                emit_br(gen_expr(node->cond), body, end);
+            else
+                emit_jmp(body);
+            start_bb(body);
+            gen_stmt(node->then);
+            if (node->inc)
+                gen_stmt(node->inc);
+            emit_jmp(cond);
+            start_bb(end);
+            return;
+        }
+        case ND_BLOCK:
+            for (Node *n = node->body; n; n = n->next)
+                gen_stmt(n);
+            return;
+    }
+
+    gen_expr(node);
+}
+
+// Lowers a function's AST into basic blocks of three-address code over
+// an unbounded set of virtual registers. The IR is allocated from the
+// function's arena.
+IRFunc *gen_ir_func(Function *f) {
+    ir_arena = &f->arena;
+    fn = arena_alloc(ir_arena, sizeof(IRFunc));
+    fn->name = f->name;
+    fn->params = f->params;
+    start_bb(new_bb());
+
+    int i = 0;
+    for (VarList *vl = f->params; vl; vl = vl->next) {
+        IR *ir = emit(IR_STORE_ARG, 0, 0, 0);
+        ir->var = vl->var;
+        ir->imm = i++;
+        ir->size = vl->var->ty->size;
+    }
+
+    for (Node *node = f->node; node; node = node->next)
+        gen_stmt(node);
+    emit(IR_RET, 0, emit_imm(0), 0);
+    return fn;
+}
+
+// Lowers every function of the program (see gen_ir_func()).
+IRFunc *gen_ir(Program *prog) {
+    IRFunc head = {};
+    IRFunc *cur = &head;
+    for (Function *f = prog->fns; f; f = f->next)
+        cur = cur->next = gen_ir_func(f);
+    return head.next;
+}
+
+//
+// --dump-ir
+//
+
+static void dump_reg(int r) {
+    out_char('r');
+    out_int(r);
+}
+
+static void dump_label(BB *bb) {
+    out_str(".L");
+    out_int(bb->label);
+}
+
+static void dump_binop(IR *ir, char *op) {
+    out_str("  ");
+    dump_reg(ir->dst);
+    out_str(" = ");
+    dump_reg(ir->a);
+    out_char(' ');
+    out_str(op);
+    out_char(' ');
+    dump_reg(ir->b);
+    out_char('\n');
+}
+
+static void dump_one(IR *ir) {
+    switch (ir->op) {
+        case IR_IMM:
+            out_str("  ");
+            dump_reg(ir->dst);
+            out_str(" = ");
+            out_int(ir->imm);
+            out_char('\n');
+            return;
+        case IR_ADDR:
+            out_str("  ");
+            dump_reg(ir->dst);
+            out_str(" = &");
+            out_str(ir->var->name);
+            out_char('\n');
+            return;
+        case IR_ADD:
+            dump_binop(ir, "+");
+            return;
+        case IR_SUB:
+            dump_binop(ir, "-");
+            return;
+        case IR_MUL:
+            dump_binop(ir, "*");
+            return;
+        case IR_DIV:
+            dump_binop(ir, "/");
+            return;
+        case IR_SHL:
+            dump_binop(ir, "<<");
+            return;
+        case IR_EQ:
+            dump_binop(ir, "==");
+            return;
+        case IR_NE:
+            dump_binop(ir, "!=");
+            return;
+        case IR_LT:
+            dump_binop(ir, "<");
+            return;
+        case IR_LE:
+            dump_binop(ir, "<=");
+            return;
+        case IR_LOAD:
+            out_str("  ");
+            dump_reg(ir->dst);
+            out_str(" = load");
+            out_int(ir->size);
+            out_char(' ');
+            dump_reg(ir->a);
+            out_char('\n');
+            return;
+        case IR_STORE:
+            out_str("  store");
+            out_int(ir->size);
+            out_char(' ');
+            dump_reg(ir->a);
+            out_str(", ");
+            dump_reg(ir->b);
+            out_char('\n');
+            return;
+        case IR_STORE_ARG:
+            out_str("  store");
+            out_int(ir->size);
+            out_str(" &");
+            out_str(ir->var->name);
+            out_str(", arg");
+            out_int(ir->imm);
+            out_char('\n');
+            return;
+        case IR_CALL:
+            out_str("  ");
+            dump_reg(ir->dst);
+            out_str(" = call ");
+            out_str(ir->name);
+            out_char('(');
+            for (int i = 0; i < ir->nargs; i++) {
+                if (i)
+                    out_str(", ");
+                dump_reg(ir->args[i]);
+            }
+            out_str(")\n");
+            return;
+        case IR_BR:
+            out_str("  br ");
+            dump_reg(ir->a);
+            out_str(", ");
+            dump_label(ir->then);
+            out_str(", ");
+            dump_label(ir->els);
+            out_char('\n');
+            return;
+        case IR_JMP:
+            out_str("  jmp ");
+            dump_label(ir->then);
+            out_char('\n');
+            return;
+        case IR_RET:
+            out_str("  ret ");
+            dump_reg(ir->a);
+            out_char('\n');
+            return;
+    }
+}
+
+// Prints the IR to the current output (see out_open()).
+void dump_ir(IRFunc *fns) {
+    for (IRFunc *f = fns; f; f = f->next) {
+        out_str(f->name);
+        out_char('(');
+        for (VarList *vl = f->params; vl; vl = vl->next) {
+            if (vl != f->params)
+                out_str(", ");
+            out_str(vl->var->name);
+        }
+        out_str("):\n");
+
+        for (BB *bb = f->bbs; bb; bb = bb->next) {
+            dump_label(bb);
+            out_str(":\n");
+            for (IR *ir = bb->ir; ir; ir = ir->next)
+                dump_one(ir);
+        }
+        out_char('\n');
+    }
+}
@@ -0,0 +1,106 @@
+#include "9cc.h"
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// 外部関数を呼ぶためのジャンプ台 (jmp [rip+0]; .quad addr)
+#define STUB_SIZE 16
+
+// 静的リンクされた 9cc では dlsym() がホストのシンボルを引けないので，
+// よく使うライブラリ関数はここから解決する
+static struct {
+    char *name;
+    void *addr;
+} builtin_syms[] = {
+    {"printf", printf},
+    {"puts", puts},
+    {"putchar", putchar},
+    {"exit", exit},
+    {"abort", abort},
+    {"malloc", malloc},
+    {"calloc", calloc},
+    {"realloc", realloc},
+    {"free", free},
+    {"memcpy", memcpy},
+    {"memset", memset},
+    {"strlen", strlen},
+    {"strcmp", strcmp},
+    {"strncmp", strncmp},
+};
+
+static void *resolve(char *name) {
+    void *addr = dlsym(RTLD_DEFAULT, name);
+    if (addr)
+        return addr;
+
+    for (int i = 0; i < sizeof(builtin_syms) / sizeof(*builtin_syms); i++)
+        if (!strcmp(builtin_syms[i].name, name))
+            return builtin_syms[i].addr;
+
+    error("%s: undefined reference to `%s'", ctx->filename, name);
+}
+
+// Compiles the program into executable memory and calls its main().
+// Returns main's return value.
+int run_jit(Program *prog, MachineCode *mc) {
+    HashMap vars = {};
+    int data_len;
+    unsigned char *data = layout_data(prog, &data_len, &vars);
+
+    // 外部関数ごとにジャンプ台を1つ用意する
+    HashMap stubs = {};
+    int nstubs = 0;
+    for (Reloc *rel = mc->relocs; rel; rel = rel->next)
+        if (rel->kind == R_PC32 && !hashmap_get(&stubs, rel->name))
+            hashmap_put(&stubs, rel->name, (void *)(intptr_t)++nstubs);
+
+    // [.text | stubs] [.data] をそれぞれページ境界から配置する．
+    // offset sym は32bitの絶対アドレスなので下位2GBに確保する
+    int page = sysconf(_SC_PAGESIZE);
+    int text_size = align_to(mc->len + nstubs * STUB_SIZE, page);
+    int data_size = align_to(data_len, page);
+    unsigned char *base = mmap(NULL, text_size + data_size, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+    if (base == MAP_FAILED)
+        error("mmap: %s", strerror(errno));
+
+    unsigned char *text = base;
+    unsigned char *stub_base = text + mc->len;
+    unsigned char *data_base = base + text_size;
+    memcpy(text, mc->buf, mc->len);
+    memcpy(data_base, data, data_len);
+
+    for (Reloc *rel = mc->relocs; rel; rel = rel->next) {
+        unsigned char *loc = text + rel->offset;
+
+        if (rel->kind == R_ABS32S) {
+            Var *var = hashmap_get(&vars, rel->name);
+            if (!var)
+                error("internal error: undefined symbol %s", rel->name);
+            int32_t addr = (intptr_t)(data_base + var->offset);
+            memcpy(loc, &addr, 4);
+            continue;
+        }
+
+        int idx = (intptr_t)hashmap_get(&stubs, rel->name) - 1;
+        unsigned char *stub = stub_base + idx * STUB_SIZE;
+        if (stub[0] != 0xff) {
+            void *addr = resolve(rel->name);
+            memcpy(stub, "\xff\x25\0\0\0\0", 6);
+            memcpy(stub + 6, &addr, 8);
+        }
+        int32_t disp = stub - (loc + 4);
+        memcpy(loc, &disp, 4);
+    }
+
+    if (mprotect(text, text_size, PROT_READ | PROT_EXEC))
+        error("mprotect: %s", strerror(errno));
+
+    for (TextSym *sym = mc->syms; sym; sym = sym->next) {
+        if (!strcmp(sym->name, "main")) {
+            int (*entry)() = (int (*)())(text + sym->offset);
+            return entry();
+        }
+    }
+    error("%s: undefined reference to `main'", ctx->filename);
+}
@@ -1,17 +1,80 @@
 #include "9cc.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-// Returns the contents of a given file
+// ファイル末尾の "\n\0" のために余分に確保するバイト数
+#define SENTINEL_SIZE 2
+
+// Reads a pipe or a terminal to the end in chunks.
+static char *read_stream(int fd, char *path, size_t *size) {
+    size_t cap = 64 * 1024;
+    size_t len = 0;
+    char *buf = malloc(cap);
+
+    for (;;) {
+        if (cap - len < SENTINEL_SIZE + 4096) {
+            cap *= 2;
+            buf = realloc(buf, cap);
+        }
+        ssize_t n = read(fd, buf + len, cap - len - SENTINEL_SIZE);
+        if (n == 0)
+            break;
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            error("cannot read %s: %s", path, strerror(errno));
+        }
+        len += n;
+    }
+
+    *size = len;
+    return buf;
+}
+
+// Maps a regular file into memory without copying it. The mapping is
+// placed at the start of an anonymous reservation that is at least
+// SENTINEL_SIZE bytes longer than the file, so the bytes after the end
+// of the file are always zero-filled and writable.
+static char *map_file(int fd, char *path, size_t size) {
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t len = (size + SENTINEL_SIZE + page - 1) & ~(page - 1);
+
+    char *buf = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED)
+        error("cannot map %s: %s", path, strerror(errno));
+    if (size == 0)
+        return buf;
+
+    // MAP_PRIVATE なので末尾に番兵を書いても最後のページがコピーされるだけ
+    if (mmap(buf, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+        error("cannot map %s: %s", path, strerror(errno));
+    return buf;
+}
+
+// Returns the contents of a given file. "-" means the standard input.
+// The returned string always ends with "\n\0" and is never freed, so
+// pointers into it stay valid for error reporting.
 static char *read_file(char *path) {
-    // Open and read
-    FILE *fp = fopen(path, "r");
-    if (!fp)
+    int fd = strcmp(path, "-") ? open(path, O_RDONLY) : STDIN_FILENO;
+    if (fd < 0)
         error("cannot open %s: %s", path, strerror(errno));
 
-    int filemax = 10 * 1024 * 1024;
-    char *buf = malloc(filemax);
-    int size = fread(buf, 1, filemax - 2, fp);
-    if (!feof(fp))
-        error("%s: file too large");
+    struct stat st;
+    if (fstat(fd, &st))
+        error("cannot stat %s: %s", path, strerror(errno));
+
+    size_t size;
+    char *buf;
+    if (S_ISREG(st.st_mode)) {
+        size = st.st_size;
+        buf = map_file(fd, path, size);
+    } else {
+        buf = read_stream(fd, path, &size);
+    }
+    if (fd != STDIN_FILENO)
+        close(fd);
 
     // Make sure that the string ends with "\n\0"
     if (size == 0 || buf[size - 1] != '\n') {
@@ -22,36 +85,204 @@ static char *read_file(char *path) {
 }
 
 
-int align_to(int n, int align) {
-    return (n + align - 1) & ~(align - 1);
+static void usage() {
+    fprintf(stderr, "usage: 9cc [-S | -c | --run] [-O<level>] [-j<jobs>] [--regalloc] [--dump-ir] [--dump-tokens] [--lex-chunk=<bytes>] [--scan=<scalar|sse2|avx2>] [--stats[=json]] [--cache-dir=<dir>] [--inline-report] [-o <path>] <file>\n");
+    exit(1);
 }
 
+static bool opt_dump_ir;
+static bool opt_dump_tokens;
+// 字句解析に使うベクトル命令 (NULL なら scan.c の DEFAULT_SCAN)
+static char *opt_scan;
+// アセンブリではなくELFオブジェクトファイルを出力する
+static bool opt_obj;
+// コンパイル結果をメモリ上でそのまま実行する
+static bool opt_run;
+// 出力先のファイル (NULL なら標準出力)
+static char *opt_o;
+// 各フェーズの時間やメモリ，最適化の統計を標準エラー出力に表示する
+static bool opt_stats;
+// --stats を JSON で出力する
+static bool opt_stats_json;
+
+static void parse_args(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--regalloc")) {
+            ctx->opt_regalloc = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-S")) {
+            opt_obj = false;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-c")) {
+            opt_obj = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-o")) {
+            if (++i == argc)
+                usage();
+            opt_o = argv[i];
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-O", 2)) {
+            ctx->opt_level = argv[i][2] ? atoi(argv[i] + 2) : 1;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-j", 2)) {
+            ctx->opt_jobs = atoi(argv[i] + 2);
+            if (ctx->opt_jobs < 1)
+                usage();
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--inline-report")) {
+            ctx->opt_inline_report = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--stats")) {
+            opt_stats = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--stats=json")) {
+            opt_stats = opt_stats_json = true;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--cache-dir=", 12)) {
+            ctx->cache_dir = argv[i] + 12;
+            if (!*ctx->cache_dir)
+                usage();
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--run")) {
+            opt_run = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--dump-ir")) {
+            opt_dump_ir = true;
+            continue;
+        }
+
+        if (!strncmp(argv[i], "--scan=", 7)) {
+            opt_scan = argv[i] + 7;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--dump-tokens")) {
+            opt_dump_tokens = true;
+            continue;
+        }
+
+        // 並列字句解析のテスト用に，小さな入力でもチャンクに分けられるようにする
+        if (!strncmp(argv[i], "--lex-chunk=", 12)) {
+            ctx->lex_chunk_size = atoi(argv[i] + 12);
+            if (ctx->lex_chunk_size < 1)
+                usage();
+            continue;
+        }
+
+        if (argv[i][0] == '-' && argv[i][1] != '\0')
+            usage();
+
+        if (ctx->filename) {
+            fprintf(stderr, "引数の個数が正しくありません\n");
+            usage();
+        }
+        ctx->filename = argv[i];
+    }
+
+    if (!ctx->filename)
+        usage();
+}
 
 int main(int argc, char **argv)
 {
-    if (argc != 2) {
-        fprintf(stderr, "引数の個数が正しくありません\n");
-        return 1;
-    }
+    ctx = context_new();
+    parse_args(argc, argv);
+
+    if (opt_stats)
+        stats_enable();
 
     // トークナイズしてパースする
-    filename = argv[1];
-    user_input = read_file(argv[1]);
-    token = tokenize();
+    stats_phase("read_file");
+    ctx->user_input = read_file(ctx->filename);
+    scan_init(opt_scan);
+    stats_phase("tokenize");
+    ctx->token = tokenize();
+    if (opt_dump_tokens) {
+        stats_phase("dump");
+        out_open(opt_o);
+        dump_tokens(ctx->token);
+        out_close();
+        print_stats(stderr, opt_stats_json);
+        return 0;
+    }
+    stats_phase("parse");
     Program *prog = program();
+    stats_phase("fold");
+    fold(prog);
+    // キャッシュするのはアセンブリの出力だけ
+    if (ctx->cache_dir && !opt_obj && !opt_run && !opt_dump_ir) {
+        stats_phase("cache");
+        cache_lookup(prog);
+    }
+    if (ctx->opt_level >= 1) {
+        stats_phase("inline");
+        inline_functions(prog);
+    }
 
-    for (Function *fn = prog->fns; fn; fn = fn->next) {
-        // ローカル変数にオフセットを設定する
-        int offset = 0;
-        for (VarList *vl = fn->locals; vl; vl = vl->next) {
-            Var *var = vl->var;
-            offset += var->ty->size;
-            var->offset = offset;
-        }
-        fn->stack_size = align_to(offset, 8);
+    stats_phase("offsets");
+    assign_lvar_offsets(prog);
+
+    if (opt_dump_ir) {
+        stats_phase("ir");
+        IRFunc *fns = gen_ir(prog);
+        out_open(opt_o);
+        dump_ir(fns);
+        out_close();
+        print_stats(stderr, opt_stats_json);
+        return 0;
+    }
+
+    stats_phase("codegen");
+    Insn *insns = codegen(prog);
+    if (ctx->opt_level >= 1) {
+        stats_phase("peephole");
+        insns = peephole(insns);
+    }
+
+    if (opt_run) {
+        stats_phase("encode");
+        MachineCode *mc = encode(insns);
+        print_stats(stderr, opt_stats_json);
+        int ret = run_jit(prog, mc);
+        fflush(stdout);
+        return ret;
     }
 
-    codegen(prog);
+    // エラーで終わった時に出力先を壊さないよう，ここで初めて開く
+    out_open(opt_o);
+    if (opt_obj) {
+        stats_phase("encode");
+        MachineCode *mc = encode(insns);
+        stats_phase("emit");
+        emit_elf(prog, mc);
+    } else {
+        stats_phase("emit");
+        emit_asm(prog, insns);
+    }
+    out_close();
+    print_stats(stderr, opt_stats_json);
 
     return 0;
 }
@@ -0,0 +1,162 @@
+#include "9cc.h"
+#include <fcntl.h>
+#include <unistd.h>
+
+// ファイルに出す時は出力をここに溜めて，一杯になったらまとめて write(2) する
+#define OUTBUF_SIZE (64 * 1024)
+
+static void capture(Output *o, char *p, size_t len) {
+    if (o->caplen + len > o->capcap) {
+        o->capcap = (o->caplen + len) * 2;
+        o->capbuf = realloc(o->capbuf, o->capcap);
+    }
+    memcpy(o->capbuf + o->caplen, p, len);
+    o->caplen += len;
+}
+
+static void write_all(Output *o, char *p, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(o->fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            error("cannot write %s: %s", o->path, strerror(errno));
+        }
+        p += n;
+        len -= n;
+        o->total += n;
+    }
+}
+
+static void grow(Output *o, size_t size) {
+    size_t cap = o->cap ? o->cap : OUTBUF_SIZE;
+    while (cap < size)
+        cap *= 2;
+    if (cap == o->cap)
+        return;
+    o->buf = realloc(o->buf, cap);
+    if (!o->buf)
+        error("out of memory");
+    o->cap = cap;
+}
+
+static void reset(Output *o, int fd, char *path) {
+    o->fd = fd;
+    o->path = path;
+    o->len = 0;
+    o->total = 0;
+    o->capturing = false;
+    grow(o, OUTBUF_SIZE);
+}
+
+// Directs the output to the given file. NULL or "-" means stdout.
+void out_open(char *path) {
+    Output *o = &ctx->output;
+    if (!path || !strcmp(path, "-")) {
+        reset(o, STDOUT_FILENO, "<stdout>");
+        return;
+    }
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+        error("cannot open %s: %s", path, strerror(errno));
+    reset(o, fd, path);
+}
+
+// Directs the output to memory. All of it is kept in ctx->output.buf.
+void out_open_mem() {
+    reset(&ctx->output, -1, "<memory>");
+}
+
+void out_flush() {
+    Output *o = &ctx->output;
+    if (o->fd < 0)
+        return;
+    if (o->capturing) {
+        capture(o, o->buf + o->capstart, o->len - o->capstart);
+        o->capstart = 0;
+    }
+    write_all(o, o->buf, o->len);
+    o->len = 0;
+}
+
+// Starts recording a copy of the output.
+void out_capture_begin() {
+    Output *o = &ctx->output;
+    o->capturing = true;
+    o->capstart = o->len;
+    o->caplen = 0;
+}
+
+// Stops recording and returns what was output since out_capture_begin()
+// as a NUL-terminated string. The string is valid until the next call.
+char *out_capture_end(int *len) {
+    Output *o = &ctx->output;
+    capture(o, o->buf + o->capstart, o->len - o->capstart);
+    capture(o, "", 1);
+    o->capturing = false;
+    *len = o->caplen - 1;
+    return o->capbuf;
+}
+
+// Returns the number of bytes output so far, including buffered ones.
+long out_bytes() {
+    return ctx->output.total + ctx->output.len;
+}
+
+void out_close() {
+    Output *o = &ctx->output;
+    out_flush();
+    if (o->fd >= 0 && o->fd != STDOUT_FILENO && close(o->fd))
+        error("cannot close %s: %s", o->path, strerror(errno));
+}
+
+void out_write(void *p, size_t len) {
+    Output *o = &ctx->output;
+    if (o->len + len > o->cap) {
+        if (o->fd < 0) {
+            grow(o, o->len + len);
+        } else {
+            out_flush();
+            // バッファに収まらない大きさのものは直接書き出す
+            if (len > o->cap) {
+                if (o->capturing)
+                    capture(o, p, len);
+                write_all(o, p, len);
+                return;
+            }
+        }
+    }
+    memcpy(o->buf + o->len, p, len);
+    o->len += len;
+}
+
+void out_char(int c) {
+    Output *o = &ctx->output;
+    if (o->len == o->cap) {
+        if (o->fd < 0)
+            grow(o, o->len + 1);
+        else
+            out_flush();
+    }
+    o->buf[o->len++] = c;
+}
+
+void out_str(char *s) {
+    out_write(s, strlen(s));
+}
+
+// Writes a decimal integer without going through printf.
+void out_int(long val) {
+    char buf[24];
+    char *p = buf + sizeof(buf);
+    unsigned long u = val < 0 ? -(unsigned long)val : val;
+
+    do {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u);
+    if (val < 0)
+        *--p = '-';
+    out_write(p, buf + sizeof(buf) - p);
+}
@@ -1,93 +1,122 @@
 #include "9cc.h"
 
 
-// 全てのローカル変数はこのリストに蓄積されていく
-static VarList *locals;
-// 全てのグローバル変数はこのリストに蓄積されていく
-static VarList *globals;
-static VarList *scope;
+// スコープ内で宣言された変数．外側の同名の変数を隠している
+typedef struct VarScope VarScope;
+struct VarScope {
+    VarScope *next;      // 同じスコープで宣言された次の変数
+    VarScope *shadowed;  // このスコープを抜けたときに見えるようになる変数
+    char *name;
+    Var *var;
+};
+
+// ブロックスコープ
+typedef struct Scope Scope;
+struct Scope {
+    Scope *next;         // 外側のスコープ
+    VarScope *vars;
+};
+
+// struct のメンバ数がこれ以上ならメンバ名のハッシュ表を作る
+#define MEMBER_MAP_THRESHOLD 8
+
+static void enter_scope() {
+    Scope *sc = arena_alloc(&ctx->parse_arena, sizeof(Scope));
+    sc->next = ctx->scope;
+    ctx->scope = sc;
+}
+
+// Leaves the innermost scope, making the variables it shadowed visible
+// again.
+static void leave_scope() {
+    for (VarScope *vs = ctx->scope->vars; vs; vs = vs->next)
+        hashmap_put(&ctx->var_map, vs->name, vs->shadowed);
+    ctx->scope = ctx->scope->next;
+}
+
+static void push_scope(Var *var) {
+    VarScope *vs = arena_alloc(&ctx->parse_arena, sizeof(VarScope));
+    vs->name = var->name;
+    vs->var = var;
+    vs->shadowed = hashmap_get(&ctx->var_map, var->name);
+    vs->next = ctx->scope->vars;
+    ctx->scope->vars = vs;
+    hashmap_put(&ctx->var_map, var->name, vs);
+}
 
 // ローカル変数を名前で見つける
-static Var *find_var(Token *tok) {
-    for (VarList *vl = scope; vl; vl = vl->next) {
-        Var *var = vl->var;
-        if (strlen(var->name) == tok->len && !strncmp(tok->str, var->name, tok->len)) {
-            return var;
-        }
-    }
-    return NULL;
+static Var *find_var(Token tok) {
+    VarScope *vs = hashmap_get2(&ctx->var_map, tok_atom(tok), ctx->tokens.len[tok]);
+    return vs ? vs->var : NULL;
 }
 
-static Node *new_node(NodeKind kind, Token *tok) {
-    Node *node = calloc(1, sizeof(Node));
+static Node *new_node(NodeKind kind, Token tok) {
+    Node *node = arena_alloc(ctx->node_arena, sizeof(Node));
+    ctx->counts.nodes++;
     node->kind = kind;
     node->tok = tok;
     return node;
 }
 
-static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
+static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token tok) {
     Node *node = new_node(kind, tok);
     node->lhs = lhs;
     node->rhs = rhs;
     return node;
 }
 
-static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
+static Node *new_unary(NodeKind kind, Node *expr, Token tok) {
     Node *node = new_node(kind, tok);
     node->lhs = expr;
     return node;
 }
 
-static Node *new_num(int val, Token *tok) {
+static Node *new_num(int val, Token tok) {
     Node *node = new_node(ND_NUM, tok);
     node->val = val;
     return node;
 }
 
-static Node *new_var_node(Var *var, Token *tok) {
+static Node *new_var_node(Var *var, Token tok) {
     Node *node = new_node(ND_VAR, tok);
     node->var = var;
     return node;
 }
 
 static Var *new_var(char *name, Type *ty, bool is_local) {
-    Var *var = calloc(1, sizeof(Var));
+    Var *var = arena_alloc(&ctx->parse_arena, sizeof(Var));
+    ctx->counts.vars++;
     var->name = name;
     var->ty = ty;
     var->is_local = is_local;
-
-    VarList *sc = calloc(1, sizeof(VarList));
-    sc->var = var;
-    sc->next = scope;
-    scope = sc;
+    push_scope(var);
     return var;
 }
 
 static Var *new_lvar(char *name, Type *ty) {
     Var *var = new_var(name, ty, true);
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = arena_alloc(&ctx->parse_arena, sizeof(VarList));
     vl->var = var;
-    vl->next = locals;
-    locals = vl;
+    vl->next = ctx->locals;
+    ctx->locals = vl;
     return var;
 }
 
 static Var *new_gvar(char *name, Type *ty) {
     Var *var = new_var(name, ty, false);
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = arena_alloc(&ctx->parse_arena, sizeof(VarList));
     vl->var = var;
-    vl->next = globals;
-    globals = vl;
+    vl->next = ctx->globals;
+    ctx->globals = vl;
     return var;
 }
 
 static char *new_label() {
-    static int cnt = 0;
     char buf[20];
-    sprintf(buf, ".L.data.%d", cnt++);
-    return strndup(buf, 20);
+    sprintf(buf, ".L.data.%d", ctx->nlabels++);
+    return arena_strndup(&ctx->parse_arena, buf, strlen(buf));
 }
 
 // program       = (global-var | function)*
@@ -146,10 +175,10 @@ static Node *primary();
 
 // トークンを一つ先読みして関数かグローバル変数かを判別する
 static bool is_function() {
-    Token *tok = token;
+    Token tok = ctx->token;
     basetype();
     bool isfunc = consume_ident() && consume("(");
-    token = tok;
+    ctx->token = tok;
     return isfunc;
 }
 
@@ -157,7 +186,9 @@ static bool is_function() {
 Program *program() {
     Function head = {};
     Function *cur = &head;
-    globals = NULL;
+    ctx->globals = NULL;
+    ctx->scope = arena_alloc(&ctx->parse_arena, sizeof(Scope));
+    ctx->var_map = (HashMap){.arena = &ctx->parse_arena};
 
     while (!at_eof()) {
         if (is_function()) {
@@ -168,16 +199,16 @@ Program *program() {
         }
     }
 
-    Program *prog = calloc(1, sizeof(Program));
-    prog->globals = globals;
+    Program *prog = arena_alloc(&ctx->parse_arena, sizeof(Program));
+    prog->globals = ctx->globals;
     prog->fns = head.next;
     return prog;
 }
 
 // basetype    = ("char" | "int" | struct-decl) "*"*
 static Type *basetype() {
-    if (!is_typename(token)) {
-        error_tok(token, "typename expected");
+    if (!is_typename(ctx->token)) {
+        error_tok(ctx->token, "typename expected");
     }
 
     Type *ty;
@@ -216,24 +247,34 @@ static Type *struct_decl() {
         cur = cur->next;
     }
 
-    Type *ty = calloc(1, sizeof(Type));
-    ty->kind = TY_STRUCT;
+    Type *ty = new_type(TY_STRUCT, 0);
     ty->members = head.next;
 
     // Assign offsets within the struct to members
     int offset = 0;
+    int nmembers = 0;
     for (Member *mem = ty->members; mem; mem = mem->next) {
         mem->offset = offset;
         offset += mem->ty->size;
+        nmembers++;
     }
     ty->size = offset;
 
+    // メンバが多ければ名前の探索をハッシュ表で行う
+    if (nmembers >= MEMBER_MAP_THRESHOLD) {
+        ty->member_map = arena_alloc(&ctx->parse_arena, sizeof(HashMap));
+        ty->member_map->arena = &ctx->parse_arena;
+        for (Member *mem = ty->members; mem; mem = mem->next)
+            if (!hashmap_get(ty->member_map, mem->name))
+                hashmap_put(ty->member_map, mem->name, mem);
+    }
+
     return ty;
 }
 
 // struct-member = basetype ident ("[" num "]")* ";"
 static Member *struct_member() {
-    Member *mem = calloc(1, sizeof(Member));
+    Member *mem = arena_alloc(&ctx->parse_arena, sizeof(Member));
     mem->ty = basetype();
     mem->name = expect_ident();
     mem->ty = read_type_suffix(mem->ty);
@@ -247,7 +288,7 @@ static VarList *read_func_param() {
     char *name = expect_ident();
     ty = read_type_suffix(ty);
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = arena_alloc(&ctx->parse_arena, sizeof(VarList));
     vl->var = new_lvar(name, ty);
     return vl;
 }
@@ -271,14 +312,17 @@ static VarList *read_func_params() {
 
 // function   = basetype ident "(" params? ")" "{" stmt* "}"
 static Function *function() {
-    locals = NULL;
+    ctx->locals = NULL;
 
-    Function *fn = calloc(1, sizeof(Function));
+    Function *fn = arena_alloc(&ctx->parse_arena, sizeof(Function));
+    fn->arena.name = "node";
+    ctx->node_arena = &fn->arena;
+    fn->tok_begin = ctx->token;
     basetype();
     fn->name = expect_ident();
     expect("(");
 
-    VarList *sc = scope;
+    enter_scope();
     fn->params = read_func_params();
     expect("{");
 
@@ -288,10 +332,11 @@ static Function *function() {
         cur->next = stmt();
         cur = cur->next;
     }
-    scope = sc;
+    leave_scope();
 
+    fn->tok_end = ctx->token;
     fn->node = head.next;
-    fn->locals = locals;
+    fn->locals = ctx->locals;
     return fn;
 }
 
@@ -306,7 +351,7 @@ static void global_var() {
 
 // declaration = basetype ident ("[" num "]")* ("=" expr) ";"
 static Node *declaration() {
-    Token *tok = token;
+    Token tok = ctx->token;
     Type *ty = basetype();
     char *name = expect_ident();
     ty = read_type_suffix(ty);
@@ -326,7 +371,7 @@ static Node *declaration() {
 }
 
 static Node *read_expr_stmt() {
-    Token *tok = token;
+    Token tok = ctx->token;
     return new_unary(ND_EXPR_STMT, expr(), tok);
 }
 
@@ -348,7 +393,7 @@ static Node *stmt() {
 //            | "for" "(" expr? ";" expr? ";" expr? ")" stmt
 //            | declaration
 static Node *stmt2() {
-    Token *tok;
+    Token tok;
     if ((tok = consume("return"))) {
         Node *node = new_unary(ND_RETURN, expr(), tok);
         expect(";");
@@ -397,12 +442,12 @@ static Node *stmt2() {
     if ((tok = consume("{"))) {
         Node head = {};
         Node *cur = &head;
-        VarList *sc = scope;
+        enter_scope();
         while (!consume("}")) {
             cur->next = stmt();
             cur = cur->next;
         }
-        scope = sc;
+        leave_scope();
 
         Node *node = new_node(ND_BLOCK, tok);
         node->body = head.next;
@@ -428,7 +473,7 @@ static Node *expr() {
 // assign       = equality ("=" assign)?
 static Node *assign() {
     Node *node = equality();
-    Token *tok;
+    Token tok;
     if ((tok = consume("=")))
         node = new_binary(ND_ASSIGN, node, assign(), tok);
     return node;
@@ -437,7 +482,7 @@ static Node *assign() {
 // equality   = relational ("==" relational | "!=" relational)*
 static Node *equality() {
     Node *node = relational();
-    Token *tok;
+    Token tok;
 
     for (;;) {
         if ((tok = consume("==")))
@@ -452,7 +497,7 @@ static Node *equality() {
 // relational = add ("<" add | "<=" add | ">" add | ">=" add)*
 static Node *relational() {
     Node *node = add();
-    Token *tok;
+    Token tok;
 
     for (;;) {
         if ((tok = consume("<")))
@@ -468,7 +513,7 @@ static Node *relational() {
     }
 }
 
-static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
+static Node *new_add(Node *lhs, Node *rhs, Token tok) {
     add_type(lhs);
     add_type(rhs);
 
@@ -484,7 +529,7 @@ static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
     error_tok(tok, "invalid operands");
 }
 
-static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
+static Node *new_sub(Node *lhs, Node *rhs, Token tok) {
     add_type(lhs);
     add_type(rhs);
 
@@ -503,7 +548,7 @@ static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
 // add        = mul ("+" mul | "-" mul)*
 static Node *add() {
     Node *node = mul();
-    Token *tok;
+    Token tok;
 
     for (;;) {
         if ((tok = consume("+")))
@@ -518,7 +563,7 @@ static Node *add() {
 // mul        = unary ("*" unary | "/" unary)*
 static Node *mul() {
     Node *node = unary();
-    Token *tok;
+    Token tok;
 
     for (;;) {
         if ((tok = consume("*")))
@@ -533,7 +578,7 @@ static Node *mul() {
 // unary      = ("+", "-", "*", "&")? unary
 //            | postfix
 static Node *unary() {
-    Token *tok;
+    Token tok;
     if ((tok = consume("+")))
         return unary();
     if ((tok = consume("-")))
@@ -545,9 +590,13 @@ static Node *unary() {
     return postfix();
 }
 
+// name は intern() されていること
 static Member *find_member(Type *ty, char *name) {
+    if (ty->member_map)
+        return hashmap_get(ty->member_map, name);
+
     for (Member *mem = ty->members; mem; mem = mem->next)
-        if (!strcmp(mem->name, name))
+        if (mem->name == name)
             return mem;
     return NULL;
 }
@@ -557,7 +606,7 @@ static Node *struct_ref(Node *lhs) {
     if (lhs->ty->kind != TY_STRUCT)
         error_tok(lhs->tok, "not a struct");
 
-    Token *tok = token;
+    Token tok = ctx->token;
     Member *mem = find_member(lhs->ty, expect_ident());
     if (!mem)
         error_tok(tok, "no such member");
@@ -571,7 +620,7 @@ static Node *struct_ref(Node *lhs) {
 // postfix     = primary ("[" expr "]" | "." ident)*
 static Node *postfix() {
     Node *node = primary();
-    Token *tok;
+    Token tok;
 
     for (;;) {
         if ((tok = consume("["))) {
@@ -593,8 +642,8 @@ static Node *postfix() {
 
 // stmt-expr = "(" "{" stmt stmt* "}" ")"
 // Statement expression is a GNU C extention
-static Node *stmt_expr(Token *tok) {
-    VarList *sc = scope;
+static Node *stmt_expr(Token tok) {
+    enter_scope();
 
     Node *node = new_node(ND_STMT_EXPR, tok);
     node->body = stmt();
@@ -607,7 +656,7 @@ static Node *stmt_expr(Token *tok) {
 
     expect(")");
 
-    scope = sc;
+    leave_scope();
 
     if (cur->kind != ND_EXPR_STMT) {
         error_tok(cur->tok, "stmt expr returning void is not supported");
@@ -639,7 +688,7 @@ static Node *func_args() {
 //             | str
 //             | num
 static Node *primary() {
-    Token *tok;
+    Token tok;
 
     // 次のトークンが"("なら "(" expr ")" のはず
     if ((tok = consume("("))) {
@@ -660,7 +709,7 @@ static Node *primary() {
         // 関数呼び出し
         if (consume("(")) {
             Node *node = new_node(ND_FUNCALL, tok);
-            node->funcname = strndup(tok->str, tok->len);
+            node->funcname = tok_atom(tok);
             node->args = func_args();
             return node;
         }
@@ -673,19 +722,19 @@ static Node *primary() {
         return new_var_node(var, tok);
     }
 
-    tok = token;
-    if (tok->kind == TK_STR) {
-        token = token->next;
+    tok = ctx->token;
+    if (ctx->tokens.kind[tok] == TK_STR) {
+        ctx->token++;
 
-        Type *ty = array_of(char_type, tok->cont_len);
+        Type *ty = array_of(char_type, tok_cont_len(tok));
         Var *var = new_gvar(new_label(), ty);
-        var->contents = tok->contents;
-        var->cont_len = tok->cont_len;
+        var->contents = tok_contents(tok);
+        var->cont_len = tok_cont_len(tok);
         return new_var_node(var, tok);
     }
 
     // そうでなければ整数のはず
-    if (tok->kind != TK_NUM)
+    if (ctx->tokens.kind[tok] != TK_NUM)
         error_tok(tok, "expected expression");
     return new_num(expect_number(), tok);
 }
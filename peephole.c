@@ -0,0 +1,132 @@
+#include "9cc.h"
+
+// 命令列の局所的な無駄を書き換える．各規則は *pp が指す命令から始まる
+// 並びを調べ，書き換えたら true を返す
+
+static bool is_mem8(Operand *opd) {
+    return opd->kind == OPD_MEM && opd->size == 8;
+}
+
+static bool same_reg(Operand *a, Operand *b) {
+    return a->kind == OPD_REG && b->kind == OPD_REG &&
+           a->size == b->size && a->reg == b->reg;
+}
+
+static bool same_mem(Operand *a, Operand *b) {
+    return a->kind == OPD_MEM && b->kind == OPD_MEM && a->size == b->size &&
+           a->reg == b->reg && a->imm == b->imm;
+}
+
+// Removes the instruction *pp from the list.
+static void remove_insn(Insn **pp) {
+    *pp = (*pp)->next;
+}
+
+// mov X, X => (なし)
+static bool self_move(Insn **pp) {
+    Insn *mov = *pp;
+    if (mov->kind != I_MOV || !same_reg(&mov->dst, &mov->src))
+        return false;
+    remove_insn(pp);
+    return true;
+}
+
+// mov X, Y; mov Y, X => mov X, Y
+static bool move_back(Insn **pp) {
+    Insn *a = *pp;
+    Insn *b = a->next;
+    if (a->kind != I_MOV || !b || b->kind != I_MOV ||
+        !same_reg(&a->dst, &b->src) || !same_reg(&a->src, &b->dst))
+        return false;
+    a->next = b->next;
+    return true;
+}
+
+// mov M, R; mov R2, M => mov M, R; mov R2, R
+//
+// 仮想レジスタをフレームのスロットに置いた時，書いた直後に読み直して
+// いるところ．R2 が R なら読み直しごと消す
+static bool store_load(Insn **pp) {
+    Insn *store = *pp;
+    Insn *load = store->next;
+    if (store->kind != I_MOV || !load || load->kind != I_MOV ||
+        !is_mem8(&store->dst) || store->src.kind != OPD_REG || store->src.size != 8 ||
+        !same_mem(&store->dst, &load->src) || load->dst.kind != OPD_REG)
+        return false;
+
+    if (same_reg(&load->dst, &store->src))
+        store->next = load->next;
+    else
+        load->src = store->src;
+    return true;
+}
+
+// first は規則が見る最初の命令の種類．それ以外の命令では規則を試さない
+static struct {
+    char *name;
+    InsnKind first;
+    bool (*fn)(Insn **pp);
+} rules[] = {
+    {"self-move", I_MOV, self_move},
+    {"move-back", I_MOV, move_back},
+    {"store-load", I_MOV, store_load},
+};
+
+#define NUM_RULES (sizeof(rules) / sizeof(*rules))
+_Static_assert(NUM_RULES == NUM_PEEPHOLE_RULES, "update NUM_PEEPHOLE_RULES");
+
+// 一番長い規則が見る命令数 - 1
+#define LOOKBACK 1
+
+static bool apply_rules(Insn **pp) {
+    for (int i = 0; i < NUM_RULES; i++) {
+        if ((*pp)->kind == rules[i].first && rules[i].fn(pp)) {
+            ctx->counts.peephole[i]++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rewrites short instruction sequences in place until no rule applies.
+// Returns the new head of the list.
+Insn *peephole(Insn *insns) {
+    Insn head = {.next = insns};
+
+    // 直前の LOOKBACK 個の命令へのリンク．書き換えによって手前の命令から
+    // 始まる並びができることがあるので，規則が当たったらそこまで戻る
+    Insn **hist[LOOKBACK];
+    int nhist = 0;
+
+    for (Insn **pp = &head.next; *pp;) {
+        if (apply_rules(pp)) {
+            if (nhist) {
+                pp = hist[0];
+                nhist = 0;
+            }
+            continue;
+        }
+
+        if (nhist == LOOKBACK) {
+            memmove(hist, hist + 1, sizeof(*hist) * (LOOKBACK - 1));
+            nhist--;
+        }
+        hist[nhist++] = pp;
+        pp = &(*pp)->next;
+    }
+    return head.next;
+}
+
+// Prints how many times each rule fired, as lines or as a JSON member.
+void print_peephole_stats(FILE *fp, bool json) {
+    if (json) {
+        fprintf(fp, "\"peephole\": {");
+        for (int i = 0; i < NUM_RULES; i++)
+            fprintf(fp, "%s\"%s\": %ld", i ? ", " : "", rules[i].name, ctx->counts.peephole[i]);
+        fprintf(fp, "}");
+        return;
+    }
+
+    for (int i = 0; i < NUM_RULES; i++)
+        fprintf(fp, "peephole %-12s %ld\n", rules[i].name, ctx->counts.peephole[i]);
+}
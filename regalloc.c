@@ -0,0 +1,208 @@
+#include "9cc.h"
+
+// IR の仮想レジスタを物理レジスタとフレームのスロットに割り当てる．
+// Poletto と Sarkar の linear scan で，生存区間は出力する順に命令に振った
+// 番号で表す．
+//
+// IR の仮想レジスタは式の途中の値なので，定義より前に使われることも，
+// ループの次の周回に持ち越されることもない．そのため定義から最後の
+// 使用までを一つの区間とすれば，間にあるループの本体も含めて生存範囲を
+// 覆える
+
+// rax, rcx, rdx, rdi は命令選択が作業用に使い，rsi, r8, r9 は引数を渡すのに
+// 使うので割り当てない．caller-saved のものは関数呼び出しをまたがない区間
+// にだけ使う
+static Reg caller_saved[] = {R10, R11};
+Reg callee_saved[NUM_CALLEE_SAVED] = {RBX, R12, R13, R14, R15};
+
+#define NUM_CALLER_SAVED (sizeof(caller_saved) / sizeof(*caller_saved))
+#define MAX_ACTIVE (NUM_CALLER_SAVED + NUM_CALLEE_SAVED)
+
+typedef struct {
+    int vreg;
+    int start;         // 定義の位置
+    int end;           // 最後に使う位置
+    bool across_call;  // 区間の内側に関数呼び出しがある
+    bool spilled;
+    int hint;          // できれば同じレジスタにしたい仮想レジスタ
+} Interval;
+
+static int compare_start(const void *x, const void *y) {
+    const Interval *a = x;
+    const Interval *b = y;
+    if (a->start != b->start)
+        return a->start < b->start ? -1 : 1;
+    return a->vreg - b->vreg;
+}
+
+static bool is_callee_saved(Reg r) {
+    for (int i = 0; i < NUM_CALLEE_SAVED; i++)
+        if (callee_saved[i] == r)
+            return true;
+    return false;
+}
+
+// Numbers the instructions in the order codegen emits them and returns
+// the live interval of every virtual register left to allocate, sorted
+// by start. *calls gets the positions of the calls.
+static Interval *build_intervals(IRFunc *f, Loc *locs, bool *reachable, int *n, int **calls, int *ncalls) {
+    int *start = calloc(f->nreg + 1, sizeof(int));
+    int *end = calloc(f->nreg + 1, sizeof(int));
+    int *hint = calloc(f->nreg + 1, sizeof(int));
+    int ninsns = 0;
+    for (BB *bb = f->bbs; bb; bb = bb->next)
+        for (IR *ir = bb->ir; ir; ir = ir->next)
+            ninsns++;
+    *calls = calloc(ninsns + 1, sizeof(int));
+    *ncalls = 0;
+
+    int pos = 0;
+    for (BB *bb = f->bbs; bb; bb = bb->next) {
+        if (!reachable[bb->label])
+            continue;
+        for (IR *ir = bb->ir; ir; ir = ir->next) {
+            pos++;
+            int regs[MAX_ARGS + 3] = {ir->dst, ir->a, ir->b};
+            int nregs = 3;
+            for (int i = 0; i < ir->nargs; i++)
+                regs[nregs++] = ir->args[i];
+
+            for (int i = 0; i < nregs; i++) {
+                int v = regs[i];
+                if (!v || locs[v].kind != LOC_NONE)
+                    continue;
+                if (!start[v])
+                    start[v] = pos;
+                end[v] = pos;
+            }
+            if (ir->op == IR_CALL)
+                (*calls)[(*ncalls)++] = pos;
+
+            // 二番地の命令は左のオペランドを結果のレジスタで計算するので，
+            // 同じレジスタなら mov が要らない
+            if (ir->op == IR_ADD || ir->op == IR_SUB || ir->op == IR_MUL || ir->op == IR_SHL)
+                hint[ir->dst] = ir->a;
+        }
+    }
+
+    Interval *iv = calloc(f->nreg + 1, sizeof(Interval));
+    *n = 0;
+    for (int v = 1; v <= f->nreg; v++)
+        if (start[v])
+            iv[(*n)++] = (Interval){v, start[v], end[v], .hint = hint[v]};
+    qsort(iv, *n, sizeof(Interval), compare_start);
+
+    // 呼び出しの位置は昇順に並んでいる
+    int c = 0;
+    for (int i = 0; i < *n; i++) {
+        while (c < *ncalls && (*calls)[c] <= iv[i].start)
+            c++;
+        // 区間の始まりは昇順なので，次の区間はここから探せばよい
+        iv[i].across_call = c < *ncalls && (*calls)[c] < iv[i].end;
+    }
+
+    free(start);
+    free(end);
+    free(hint);
+    return iv;
+}
+
+// Returns a free register for the interval, or -1.
+static int pick_reg(Interval *it, Loc *locs, bool *busy) {
+    Loc *hint = &locs[it->hint];
+    if (it->hint && hint->kind == LOC_REG && !busy[hint->reg] &&
+        (!it->across_call || is_callee_saved(hint->reg)))
+        return hint->reg;
+
+    if (!it->across_call)
+        for (int i = 0; i < NUM_CALLER_SAVED; i++)
+            if (!busy[caller_saved[i]])
+                return caller_saved[i];
+    for (int i = 0; i < NUM_CALLEE_SAVED; i++)
+        if (!busy[callee_saved[i]])
+            return callee_saved[i];
+    return -1;
+}
+
+// Assigns a register or a frame slot to every virtual register whose
+// location is LOC_NONE. Without --regalloc all of them go to the frame.
+// Spilled registers get slots below offset, and a slot is reused once
+// its previous owner is dead. Returns the new frame size. *nsaved is
+// the number of callee_saved registers used, which are always the first
+// ones in the array.
+int regalloc(IRFunc *f, Loc *locs, bool *reachable, int offset, int *nsaved) {
+    int n, ncalls;
+    int *calls;
+    Interval *iv = build_intervals(f, locs, reachable, &n, &calls, &ncalls);
+
+    // 割り当て中の区間．終わりの昇順に並べる
+    Interval *active[MAX_ACTIVE];
+    int nactive = 0;
+    bool busy[R15 + 1] = {};
+    *nsaved = 0;
+
+    for (int i = 0; i < n; i++) {
+        Interval *it = &iv[i];
+        if (!ctx->opt_regalloc) {
+            it->spilled = true;
+            continue;
+        }
+
+        // 終わった区間のレジスタを空ける．命令選択は結果を書く前に
+        // オペランドを読むので，この命令で終わる区間のものも使える
+        int j = 0;
+        while (j < nactive && active[j]->end <= it->start)
+            busy[locs[active[j++]->vreg].reg] = false;
+        memmove(active, active + j, (nactive - j) * sizeof(*active));
+        nactive -= j;
+
+        int r = pick_reg(it, locs, busy);
+        if (r < 0) {
+            // 空きがなければ，終わりが一番遠い区間をメモリに追い出す
+            int k = nactive - 1;
+            while (k >= 0 && it->across_call && !is_callee_saved(locs[active[k]->vreg].reg))
+                k--;
+            if (k < 0 || active[k]->end <= it->end) {
+                it->spilled = true;
+                continue;
+            }
+            active[k]->spilled = true;
+            r = locs[active[k]->vreg].reg;
+            memmove(active + k, active + k + 1, (nactive - k - 1) * sizeof(*active));
+            nactive--;
+        }
+
+        locs[it->vreg] = (Loc){LOC_REG, r};
+        busy[r] = true;
+        for (int k = 0; k < NUM_CALLEE_SAVED; k++)
+            if (callee_saved[k] == r && *nsaved <= k)
+                *nsaved = k + 1;
+
+        int k = nactive++;
+        for (; k > 0 && active[k - 1]->end > it->end; k--)
+            active[k] = active[k - 1];
+        active[k] = it;
+    }
+
+    // 残りはフレームのスロットに置く．slot_end はスロットを使っている区間の終わり
+    int *slot_end = calloc(n + 1, sizeof(int));
+    int nslots = 0;
+    for (int i = 0; i < n; i++) {
+        Interval *it = &iv[i];
+        if (!it->spilled)
+            continue;
+
+        int s = 0;
+        while (s < nslots && slot_end[s] > it->start)
+            s++;
+        if (s == nslots)
+            nslots++;
+        slot_end[s] = it->end;
+        locs[it->vreg] = (Loc){LOC_STACK, .offset = offset + (s + 1) * 8};
+    }
+
+    free(slot_end);
+    free(calls);
+    free(iv);
+    return offset + nslots * 8;
+}
@@ -0,0 +1,232 @@
+#include "9cc.h"
+#include <pthread.h>
+
+// 字句解析の内側のループ．16バイトや32バイトずつまとめて文字を分類する．
+//
+// ベクトル版はアラインされたブロックだけを読む．アラインされたブロックは
+// ページをまたがないので，入力末尾の '\0' より先を読んでも落ちることはない．
+// どのカーネルも '\0' では必ず止まる
+
+enum {
+    CT_SPACE = 1,  // 空白文字
+    CT_IDENT = 2,  // 識別子の2文字目以降になれる文字
+};
+
+static unsigned char ctype[256];
+
+static void init_ctype() {
+    for (int c = 1; c < 256; c++) {
+        bool space = c == ' ' || ('\t' <= c && c <= '\r');
+        bool ident = ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_';
+        ctype[c] = (space ? CT_SPACE : 0) | (ident ? CT_IDENT : 0);
+    }
+}
+
+// Returns the first non-whitespace byte at or after p.
+static char *skip_space_scalar(char *p) {
+    while (ctype[(unsigned char)*p] & CT_SPACE)
+        p++;
+    return p;
+}
+
+// Returns the first byte at or after p that cannot be in an identifier.
+static char *skip_ident_scalar(char *p) {
+    while (ctype[(unsigned char)*p] & CT_IDENT)
+        p++;
+    return p;
+}
+
+// Returns the first byte at or after p that is a, b or '\0'.
+static char *find_byte2_scalar(char *p, char a, char b) {
+    while (*p != a && *p != b && *p)
+        p++;
+    return p;
+}
+
+#ifdef __x86_64__
+#include <immintrin.h>
+
+// ブロック内で止まるべきバイトのビットマスクを stop(blk) で計算しながら，
+// p から先に進む．最初のブロックは p より前の分のビットを捨てる
+#define SCAN(W, stop)                                           \
+    do {                                                        \
+        uintptr_t off = (uintptr_t)p & (W - 1);                 \
+        char *blk = p - off;                                    \
+        uint32_t m = (uint32_t)stop(blk) >> off;                \
+        if (m)                                                  \
+            return p + __builtin_ctz(m);                        \
+        for (blk += W;; blk += W) {                             \
+            m = stop(blk);                                      \
+            if (m)                                              \
+                return blk + __builtin_ctz(m);                  \
+        }                                                       \
+    } while (0)
+
+// 空白や識別子は数バイトで終わることがほとんどで，そこでベクトル命令の
+// 定数を用意してブロックを読むと1バイトずつ見るより遅い．最初の SHORT_RUN
+// バイトは表を引いて調べ，それより長く続く時だけ SCAN に進む
+#define SHORT_RUN 16
+
+#define SKIP_SHORT(cls)                                         \
+    do {                                                        \
+        for (int i = 0; i < SHORT_RUN; i++, p++)                \
+            if (!(ctype[(unsigned char)*p] & (cls)))            \
+                return p;                                       \
+    } while (0)
+
+// 符号なしで lo <= c <= hi のバイトを真にする
+#define IN_RANGE(W, v, lo, hi) \
+    W##_cmpeq_epi8(W##_min_epu8(W##_sub_epi8(v, W##_set1_epi8(lo)), W##_set1_epi8((hi) - (lo))), \
+                   W##_sub_epi8(v, W##_set1_epi8(lo)))
+
+static inline uint32_t sse2_not_space(char *blk) {
+    __m128i v = _mm_load_si128((__m128i *)blk);
+    __m128i sp = _mm_or_si128(IN_RANGE(_mm, v, '\t', '\r'), _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+    return ~_mm_movemask_epi8(sp) & 0xffff;
+}
+
+static inline uint32_t sse2_not_ident(char *blk) {
+    __m128i v = _mm_load_si128((__m128i *)blk);
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i id = _mm_or_si128(IN_RANGE(_mm, lower, 'a', 'z'), IN_RANGE(_mm, v, '0', '9'));
+    id = _mm_or_si128(id, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    return ~_mm_movemask_epi8(id) & 0xffff;
+}
+
+static char *skip_space_sse2(char *p) {
+    SKIP_SHORT(CT_SPACE);
+    SCAN(16, sse2_not_space);
+}
+
+static char *skip_ident_sse2(char *p) {
+    SKIP_SHORT(CT_IDENT);
+    SCAN(16, sse2_not_ident);
+}
+
+static inline uint32_t sse2_byte2(char *blk, __m128i va, __m128i vb) {
+    __m128i v = _mm_load_si128((__m128i *)blk);
+    __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb));
+    return _mm_movemask_epi8(_mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_setzero_si128())));
+}
+
+static char *find_byte2_sse2(char *p, char a, char b) {
+    __m128i va = _mm_set1_epi8(a);
+    __m128i vb = _mm_set1_epi8(b);
+#define STOP(blk) sse2_byte2(blk, va, vb)
+    SCAN(16, STOP);
+#undef STOP
+}
+
+#define AVX2 __attribute__((target("avx2")))
+
+static inline AVX2 uint32_t avx2_not_space(char *blk) {
+    __m256i v = _mm256_load_si256((__m256i *)blk);
+    __m256i sp = _mm256_or_si256(IN_RANGE(_mm256, v, '\t', '\r'), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+    return ~_mm256_movemask_epi8(sp);
+}
+
+static inline AVX2 uint32_t avx2_not_ident(char *blk) {
+    __m256i v = _mm256_load_si256((__m256i *)blk);
+    __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i id = _mm256_or_si256(IN_RANGE(_mm256, lower, 'a', 'z'), IN_RANGE(_mm256, v, '0', '9'));
+    id = _mm256_or_si256(id, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+    return ~_mm256_movemask_epi8(id);
+}
+
+static AVX2 char *skip_space_avx2(char *p) {
+    SKIP_SHORT(CT_SPACE);
+    SCAN(32, avx2_not_space);
+}
+
+static AVX2 char *skip_ident_avx2(char *p) {
+    SKIP_SHORT(CT_IDENT);
+    SCAN(32, avx2_not_ident);
+}
+
+static inline AVX2 uint32_t avx2_byte2(char *blk, __m256i va, __m256i vb) {
+    __m256i v = _mm256_load_si256((__m256i *)blk);
+    __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb));
+    return _mm256_movemask_epi8(_mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+}
+
+static AVX2 char *find_byte2_avx2(char *p, char a, char b) {
+    __m256i va = _mm256_set1_epi8(a);
+    __m256i vb = _mm256_set1_epi8(b);
+#define STOP(blk) avx2_byte2(blk, va, vb)
+    SCAN(32, STOP);
+#undef STOP
+}
+#endif
+
+static struct {
+    char *name;
+    char *(*skip_space)(char *p);
+    char *(*skip_ident)(char *p);
+    char *(*find_byte2)(char *p, char a, char b);
+} impls[] = {
+    {"scalar", skip_space_scalar, skip_ident_scalar, find_byte2_scalar},
+#ifdef __x86_64__
+    {"sse2", skip_space_sse2, skip_ident_sse2, find_byte2_sse2},
+    {"avx2", skip_space_avx2, skip_ident_avx2, find_byte2_avx2},
+#endif
+};
+
+#define NUM_IMPLS (sizeof(impls) / sizeof(*impls))
+
+char *(*skip_space)(char *p) = skip_space_scalar;
+char *(*skip_ident)(char *p) = skip_ident_scalar;
+char *(*find_byte2)(char *p, char a, char b) = find_byte2_scalar;
+
+static bool supported(int i) {
+#ifdef __x86_64__
+    __builtin_cpu_init();
+    if (!strcmp(impls[i].name, "avx2"))
+        return __builtin_cpu_supports("avx2");
+#endif
+    return true;
+}
+
+// 何も指定しなければ SSE2 を使う．トークンや空白の並びは短いので，32バイト
+// ずつ読む AVX2 は bench/lexbench.sh で SSE2 より速くならず，遅くなる
+// マシンもあった
+#ifdef __x86_64__
+#define DEFAULT_SCAN "sse2"
+#else
+#define DEFAULT_SCAN "scalar"
+#endif
+
+// カーネルと ctype はプロセスで一度だけ選んで初期化する．字句解析中の
+// スレッドがある時に書き換えないよう，後から別のものは選ばせない
+static pthread_mutex_t scan_lock = PTHREAD_MUTEX_INITIALIZER;
+static char *selected;
+
+// Selects the scanning kernels. name must be one of "scalar", "sse2" or
+// "avx2"; NULL picks DEFAULT_SCAN unless a scanner is already selected.
+// Once selected, asking for a different scanner is an error.
+void scan_init(char *name) {
+    int i = -1;
+    if (name) {
+        for (i = 0; i < NUM_IMPLS; i++)
+            if (!strcmp(impls[i].name, name))
+                break;
+        if (i == NUM_IMPLS || !supported(i))
+            error("scanner %s is not available", name);
+    }
+
+    pthread_mutex_lock(&scan_lock);
+    char *prev = selected;
+    if (!prev) {
+        if (i < 0)
+            for (i = 0; strcmp(impls[i].name, DEFAULT_SCAN); i++)
+                ;
+        init_ctype();
+        skip_space = impls[i].skip_space;
+        skip_ident = impls[i].skip_ident;
+        find_byte2 = impls[i].find_byte2;
+        selected = impls[i].name;
+    }
+    pthread_mutex_unlock(&scan_lock);
+
+    if (prev && name && strcmp(prev, name))
+        error("scanner %s is already selected", prev);
+}
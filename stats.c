@@ -0,0 +1,105 @@
+#include "9cc.h"
+#include <malloc.h>
+#include <sys/resource.h>
+#include <time.h>
+
+// コンパイラ自身の性能の計測．--stats の時だけ有効になる
+
+static double clock_sec(clockid_t id) {
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// malloc したバイト数．mallinfo2() はメインスレッドのアリーナしか数えない
+// ので，-j で codegen のワーカーが確保した分は入らない
+static long heap_used() {
+    struct mallinfo2 mi = mallinfo2();
+    return mi.uordblks + mi.hblkhd;
+}
+
+void stats_enable() {
+    ctx->stats.enabled = true;
+}
+
+// Ends the current phase, if any, and starts a new one called name.
+// NULL just ends the current phase.
+void stats_phase(char *name) {
+    Stats *st = &ctx->stats;
+    if (!st->enabled)
+        return;
+
+    double wall = clock_sec(CLOCK_MONOTONIC);
+    double cpu = clock_sec(CLOCK_PROCESS_CPUTIME_ID);
+    long heap = heap_used();
+
+    Phase *cur = st->cur;
+    if (cur) {
+        cur->wall = wall - cur->wall;
+        cur->cpu = cpu - cur->cpu;
+        cur->alloc = heap - cur->alloc;
+        st->cur = NULL;
+    }
+
+    if (!name)
+        return;
+    if (st->nphases == MAX_PHASES)
+        unreachable();
+    st->cur = &st->phases[st->nphases++];
+    *st->cur = (Phase){name, wall, cpu, heap};
+}
+
+static long peak_rss_kb() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+// Prints the phase times, counts and peephole statistics to fp, either
+// as a table or as a single JSON object.
+void print_stats(FILE *fp, bool json) {
+    Stats *st = &ctx->stats;
+    if (!st->enabled)
+        return;
+    stats_phase(NULL);
+
+    Phase *phases = st->phases;
+    int nphases = st->nphases;
+    Phase total = {"total"};
+    for (int i = 0; i < nphases; i++) {
+        total.wall += phases[i].wall;
+        total.cpu += phases[i].cpu;
+        total.alloc += phases[i].alloc;
+    }
+
+    if (json) {
+        fprintf(fp, "{\"phases\": [");
+        for (int i = 0; i < nphases; i++) {
+            Phase *ph = &phases[i];
+            fprintf(fp, "%s{\"name\": \"%s\", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"alloc_bytes\": %ld}",
+                    i ? ", " : "", ph->name, ph->wall * 1000, ph->cpu * 1000, ph->alloc);
+        }
+        fprintf(fp, "], \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"alloc_bytes\": %ld",
+                total.wall * 1000, total.cpu * 1000, total.alloc);
+        fprintf(fp, ", \"tokens\": %ld, \"nodes\": %ld, \"types\": %ld, \"vars\": %ld",
+                ctx->counts.tokens, ctx->counts.nodes, ctx->counts.types, ctx->counts.vars);
+        if (ctx->cache_dir)
+            fprintf(fp, ", \"cache_hits\": %ld, \"cache_misses\": %ld", ctx->counts.cache_hits, ctx->counts.cache_misses);
+        fprintf(fp, ", \"peak_rss_kb\": %ld, \"output_bytes\": %ld, ", peak_rss_kb(), out_bytes());
+        print_peephole_stats(fp, true);
+        fprintf(fp, "}\n");
+        return;
+    }
+
+    fprintf(fp, "%-12s %10s %10s %12s\n", "phase", "wall ms", "cpu ms", "alloc KB");
+    for (int i = 0; i <= nphases; i++) {
+        Phase *ph = i < nphases ? &phases[i] : &total;
+        fprintf(fp, "%-12s %10.3f %10.3f %12.1f\n", ph->name, ph->wall * 1000, ph->cpu * 1000, ph->alloc / 1024.0);
+    }
+    fprintf(fp, "tokens %ld, nodes %ld, types %ld, vars %ld\n",
+            ctx->counts.tokens, ctx->counts.nodes, ctx->counts.types, ctx->counts.vars);
+    if (ctx->cache_dir)
+        fprintf(fp, "cache hits %ld, misses %ld\n", ctx->counts.cache_hits, ctx->counts.cache_misses);
+    fprintf(fp, "peak RSS %ld KB, output %ld bytes\n", peak_rss_kb(), out_bytes());
+    print_peephole_stats(fp, false);
+}
@@ -0,0 +1,62 @@
+#!/bin/sh
+# Differential test of the tokenizer. Generates random inputs full of
+# strings, comments and stray quotes, and checks that 9cc gives the same
+# tokens, errors and exit status as the scalar sequential lexer with
+# every vector scanner and with chunking.
+#
+# usage: test/lexfuzz.sh [iterations]
+
+n=${1:-200}
+tmp=${TMPDIR:-/tmp}/9cc-lexfuzz.$$
+trap 'rm -f $tmp.*' EXIT
+
+variants="-j4_--lex-chunk=1 -j4_--lex-chunk=7 -j4_--lex-chunk=64"
+for scan in sse2 avx2; do
+    if ./9cc --scan=$scan --dump-tokens /dev/null > /dev/null 2>&1; then
+        variants="$variants --scan=$scan"
+    fi
+done
+
+i=1
+while [ $i -le $n ]; do
+    awk -v seed=$i 'BEGIN {
+        srand(seed)
+        split("int|x1|foo_bar|return|while|42|0|==|!=|<=|>=|+|-|*|/|;|{|}|(|)|[|]|&|,|=|<|>", piece, "|")
+        piece[26] = "a_very_long_identifier_that_spans_more_than_32_bytes_Z9"
+        piece[27] = "\t\t    \n        \v\f\r                                    "
+        split("\"abc\"|\"a\\\"b\"|\"\\\\\"|\"/*\"|\"//\"|\"x\\ny\"", str, "|")
+        str[7] = "\"a string without escapes that is longer than one vector\""
+        split("// line \"comment\"\n|/* block \" */|/* a\n * b */|/*/ x */|/**/", cmt, "|")
+        cmt[6] = "/*****************************************************/"
+        cmt[7] = "/* * / ** // \" stars but no end until here **/"
+        len = int(rand() * 400)
+        for (j = 0; j < len; j++) {
+            r = rand()
+            if (r < 0.6) printf "%s", piece[int(rand() * 27) + 1]
+            else if (r < 0.7) printf "%s", str[int(rand() * 7) + 1]
+            else if (r < 0.8) printf "%s", cmt[int(rand() * 7) + 1]
+            else if (r < 0.95) printf " "
+            else printf "\n"
+        }
+        # たまに閉じていない文字列やコメント，不正な文字を混ぜる
+        r = rand()
+        if (r < 0.05) printf "\"unclosed"
+        else if (r < 0.1) printf "/* unclosed"
+        else if (r < 0.15) printf "\001"
+        printf "\n"
+    }' > $tmp.c
+
+    ./9cc --scan=scalar --dump-tokens $tmp.c > $tmp.ref 2>&1
+    ref=$?
+    for v in $variants; do
+        ./9cc $(echo $v | tr _ ' ') --dump-tokens $tmp.c > $tmp.out 2>&1
+        out=$?
+        if [ $ref != $out ] || ! cmp -s $tmp.ref $tmp.out; then
+            echo "lexfuzz: mismatch with seed $i, $v"
+            cp $tmp.c tmp-lexfuzz.in
+            exit 1
+        fi
+    done
+    i=$((i + 1))
+done
+echo "lexfuzz: $n inputs OK"
@@ -0,0 +1,155 @@
+// Tests the library interface. Compiles a file in-process and checks
+// that the output equals what the 9cc command wrote, that a context can
+// be reused after both successful and failed compiles, that errors come
+// back as diagnostics instead of ending the process, that statistics
+// are counted per compile, and that contexts on different threads do
+// not interfere.
+//
+// usage: libtest <source> <expected.s> <expected-O1.s>
+
+#include "../9cc.h"
+#include <pthread.h>
+
+#define NTHREADS 4
+#define NREPEAT 20
+
+static char *src;
+static size_t srclen;
+
+static char *read_all(char *path, size_t *len) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        perror(path);
+        exit(1);
+    }
+    fseek(fp, 0, SEEK_END);
+    *len = ftell(fp);
+    rewind(fp);
+    char *buf = malloc(*len + 1);
+    if (fread(buf, 1, *len, fp) != *len) {
+        perror(path);
+        exit(1);
+    }
+    buf[*len] = '\0';
+    fclose(fp);
+    return buf;
+}
+
+static void check_output(CompileContext *c, char *expected, size_t len, char *what) {
+    if (c->output.len != len || memcmp(c->output.buf, expected, len)) {
+        fprintf(stderr, "libtest: %s: output differs from the 9cc command\n", what);
+        exit(1);
+    }
+}
+
+static void check_compile(CompileContext *c, char *expected, size_t len, char *what) {
+    if (compile(c, "tests", src, srclen)) {
+        Diagnostic *d = &c->diags[0];
+        fprintf(stderr, "libtest: %s: %s:%d:%d: %s\n", what, d->filename, d->line, d->column, d->message);
+        exit(1);
+    }
+    check_output(c, expected, len, what);
+}
+
+static void check_error(CompileContext *c, char *code, int line, int column, char *msg) {
+    if (!compile(c, "err.c", code, strlen(code))) {
+        fprintf(stderr, "libtest: no error for: %s\n", code);
+        exit(1);
+    }
+    Diagnostic *d = &c->diags[0];
+    if (c->ndiags != 1 || strcmp(d->filename, "err.c") || d->line != line ||
+        d->column != column || strcmp(d->message, msg)) {
+        fprintf(stderr, "libtest: %s: got %s:%d:%d: %s\n", code, d->filename, d->line, d->column, d->message);
+        exit(1);
+    }
+}
+
+static char *expected;
+static size_t explen;
+
+static void *thread_main(void *arg) {
+    CompileContext *c = context_new();
+    for (int i = 0; i < NREPEAT; i++)
+        check_compile(c, expected, explen, "thread");
+    context_free(c);
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        fprintf(stderr, "usage: libtest <source> <expected.s> <expected-O1.s>\n");
+        return 2;
+    }
+
+    size_t o1len;
+    src = read_all(argv[1], &srclen);
+    expected = read_all(argv[2], &explen);
+    char *o1 = read_all(argv[3], &o1len);
+
+    // 同じコンテキストで何度コンパイルしても同じ結果になる
+    CompileContext *c = context_new();
+    check_compile(c, expected, explen, "first compile");
+    check_compile(c, expected, explen, "second compile");
+
+    // 統計はコンパイルごとに数え直す
+    c->opt_level = 1;
+    check_compile(c, o1, o1len, "-O1");
+    Counts counts = c->counts;
+    check_compile(c, o1, o1len, "-O1 again");
+    long rewrites = 0;
+    for (int i = 0; i < NUM_PEEPHOLE_RULES; i++)
+        rewrites += counts.peephole[i];
+    if (!rewrites || memcmp(&counts, &c->counts, sizeof(Counts))) {
+        fprintf(stderr, "libtest: counts are not reset between compiles\n");
+        exit(1);
+    }
+    c->opt_level = 0;
+
+    // キャッシュも使える．2回目は全ての関数がキャッシュにある
+    c->cache_dir = "tmp-libcache";
+    check_compile(c, expected, explen, "cache");
+    check_compile(c, expected, explen, "cache again");
+    if (c->counts.cache_misses || !c->counts.cache_hits) {
+        fprintf(stderr, "libtest: cache: %ld hits, %ld misses\n", c->counts.cache_hits, c->counts.cache_misses);
+        exit(1);
+    }
+    c->cache_dir = NULL;
+
+    // エラーの後も使い回せる
+    check_error(c, "int main() {\n  return x;\n}\n", 2, 10, "undefined variable");
+    check_error(c, "int main() { 1 = 2; }", 1, 14, "Not an lvalue");
+    check_error(c, "int main() { f(1,2,3,4,5,6,7); }", 1, 28, "too many arguments");
+    check_error(c, "int main() { \"abc; }", 1, 14, "unclosed string literal");
+    check_compile(c, expected, explen, "compile after an error");
+
+    // 並列字句解析のワーカーでのエラーも呼び出し元に返る
+    c->opt_jobs = 4;
+    c->lex_chunk_size = 16;
+    check_error(c, "int main() {\n  return 0;\n}\nint f() {\n  return 1;\n}\nint g() { \"abc; }\n",
+                7, 11, "unclosed string literal");
+    check_compile(c, expected, explen, "parallel lexing");
+    c->opt_jobs = 1;
+    c->lex_chunk_size = 256 * 1024;
+
+    // 関数ごとのアリーナは parse のアリーナの中にあるので，複数の関数の
+    // アリーナをまとめて解放しても壊れた領域を読まない (test-asan で調べる)
+    char *fns = "int f() { return 1; }\nint g() { return f() + 1; }\nint main() { return g(); }\n";
+    if (compile(c, "fns.c", fns, strlen(fns))) {
+        fprintf(stderr, "libtest: fns.c: %s\n", c->diags[0].message);
+        exit(1);
+    }
+    context_reset(c);
+    context_free(c);
+
+    pthread_t threads[NTHREADS];
+    for (int i = 0; i < NTHREADS; i++)
+        pthread_create(&threads[i], NULL, thread_main, NULL);
+    for (int i = 0; i < NTHREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    free(src);
+    free(expected);
+    free(o1);
+    printf("libtest: OK\n");
+    return 0;
+}
@@ -0,0 +1,3331 @@
+.intel_syntax noprefix
+.data
+.L.data.199:
+  .string "OK\012"
+.L.data.198:
+  .string "long function name"
+.L.data.197:
+  .string "&x.i - &x.a"
+.L.data.196:
+  .string "struct {int a; ... int i;} x; x.a=1; x.i=9; x.i;"
+.L.data.195:
+  .string "int x=1; int y=0; { int x=2; { int x=3; y=x; } } y;"
+.L.data.194:
+  .string "int x=1; { int x=2; { int x=3; } } x;"
+.L.data.193:
+  .string "int x[4]; x[3]=5; int *p=x+3; *(p-0);"
+.L.data.192:
+  .string "int x[4]; x[3]=5; *(x+4-1);"
+.L.data.191:
+  .string "int x=7; x*3;"
+.L.data.190:
+  .string "int x=-3; x*8;"
+.L.data.189:
+  .string "int x=7; 8*x;"
+.L.data.188:
+  .string "int x=7; x*8;"
+.L.data.187:
+  .string "int x=7; x/1;"
+.L.data.186:
+  .string "int x=7; x-0;"
+.L.data.185:
+  .string "int x=7; 0+x;"
+.L.data.184:
+  .string "int x=7; x+0;"
+.L.data.183:
+  .string "int x=7; 1*x;"
+.L.data.182:
+  .string "int x=7; x*1;"
+.L.data.181:
+  .string "1+2<3"
+.L.data.180:
+  .string "2*3==6"
+.L.data.179:
+  .string "7/2"
+.L.data.178:
+  .string "4*8"
+.L.data.177:
+  .string "struct {char a; int b;} x; sizeof(x);"
+.L.data.176:
+  .string "struct {char a; char b;} x; sizeof(x);"
+.L.data.175:
+  .string "struct {int a[3];} x[2]; sizeof(x)};"
+.L.data.174:
+  .string "struct {int a;} x[4]; sizeof(x);"
+.L.data.173:
+  .string "struct {int a[3];} x; sizeof(x);"
+.L.data.172:
+  .string "struct {int a; int b;} x; sizeof(x);"
+.L.data.171:
+  .string "struct {int a;} x; sizeof(x);"
+.L.data.170:
+  .string "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.data.169:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.data.168:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.data.167:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.data.166:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.data.165:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.data.164:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.data.163:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.data.162:
+  .string "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.data.161:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.data.160:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.data.159:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.data.158:
+  .string "int x[5]; int *y=x+2; y-x;"
+.L.data.157:
+  .string "int x[5]; int *y = x + 2; y - x;"
+.L.data.156:
+  .string "int x=2; { x=3; } x;"
+.L.data.155:
+  .string "int x=2; { int x=3; } int y=4; x;"
+.L.data.154:
+  .string "int x=2; { int x=3; } x;"
+.L.data.153:
+  .string "1100-byte string[1099]"
+.L.data.152:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.151:
+  .string "1100-byte string[1100]"
+.L.data.150:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.149:
+  .string "sizeof(1100-byte string)"
+.L.data.148:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.147:
+  .string "130-byte string[129]"
+.L.data.146:
+  .ascii "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl"
+  .ascii "mnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwx"
+  .string "yz"
+.L.data.145:
+  .string "sizeof(130-byte string)"
+.L.data.144:
+  .ascii "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl"
+  .ascii "mnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwx"
+  .string "yz"
+.L.data.143:
+  .string "\"\\l\"[0]"
+.L.data.142:
+  .string "l"
+.L.data.141:
+  .string "\"\\k\"[0]"
+.L.data.140:
+  .string "k"
+.L.data.139:
+  .string "\"\\j\"[0]"
+.L.data.138:
+  .string "j"
+.L.data.137:
+  .string "\"\\0\"[0]"
+.L.data.136:
+  .string "\000"
+.L.data.135:
+  .string "\"\\e\"[0]"
+.L.data.134:
+  .string "\033"
+.L.data.133:
+  .string "\"\\r\"[0]"
+.L.data.132:
+  .string "\015"
+.L.data.131:
+  .string "\"\\f\"[0]"
+.L.data.130:
+  .string "\014"
+.L.data.129:
+  .string "\"\\v\"[0]"
+.L.data.128:
+  .string "\013"
+.L.data.127:
+  .string "\"\\n\"[0]"
+.L.data.126:
+  .string "\012"
+.L.data.125:
+  .string "\"\\t\"[0]"
+.L.data.124:
+  .string "\011"
+.L.data.123:
+  .string "\"\\b\"[0]"
+.L.data.122:
+  .string "\010"
+.L.data.121:
+  .string "\"\\a\"[0]"
+.L.data.120:
+  .string "\007"
+.L.data.119:
+  .string "sizeof(\"abc\")"
+.L.data.118:
+  .string "abc"
+.L.data.117:
+  .string "\"abc\"[3]"
+.L.data.116:
+  .string "abc"
+.L.data.115:
+  .string "\"abc\"[2]"
+.L.data.114:
+  .string "abc"
+.L.data.113:
+  .string "\"abc\"[1]"
+.L.data.112:
+  .string "abc"
+.L.data.111:
+  .string "\"abc\"[0]"
+.L.data.110:
+  .string "abc"
+.L.data.109:
+  .string "sub_char(7, 3, 3)"
+.L.data.108:
+  .string "char x[10]; sizeof(x);"
+.L.data.107:
+  .string "char x; sizeof(x);"
+.L.data.106:
+  .string "char x=1; char y=2; y;"
+.L.data.105:
+  .string "char x=1; char y=2; x;"
+.L.data.104:
+  .string "char x=1; x;"
+.L.data.103:
+  .string "sizeof(g2)"
+.L.data.102:
+  .string "sizeof(g1)"
+.L.data.101:
+  .string "g2[3]"
+.L.data.100:
+  .string "g2[2]"
+.L.data.99:
+  .string "g2[1]"
+.L.data.98:
+  .string "g2[0]"
+.L.data.97:
+  .string "g1"
+.L.data.96:
+  .string "g1"
+.L.data.95:
+  .string "int x[3][4]; sizeof(**x + 1);"
+.L.data.94:
+  .string "int x[3][4]; sizeof **x + 1;"
+.L.data.93:
+  .string "int x[3][4]; sizeof(**x) + 1;"
+.L.data.92:
+  .string "int x[3][4]; sizeof(**x);"
+.L.data.91:
+  .string "int x[3][4]; sizeof(*x);"
+.L.data.90:
+  .string "int x[3][4]; sizeof(x);"
+.L.data.89:
+  .string "int x[4]; sizeof(x);"
+.L.data.88:
+  .string "int *x; sizeof(x);"
+.L.data.87:
+  .string "int x; sizeof x;"
+.L.data.86:
+  .string "int x; sizeof(x);"
+.L.data.85:
+  .string "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.data.84:
+  .string "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.data.83:
+  .string "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.data.82:
+  .string "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.data.81:
+  .string "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.data.80:
+  .string "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.data.79:
+  .string "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.data.78:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.77:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.76:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.data.75:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.data.74:
+  .string "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.data.73:
+  .string "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.data.72:
+  .string "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.data.71:
+  .string "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.data.70:
+  .string "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.data.69:
+  .string "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.data.68:
+  .string "int x[2][3]; int *y=x; *y=0; **x;"
+.L.data.67:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.data.66:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.data.65:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.data.64:
+  .string "int x[2]; int *y=&x; *y=3; *x;"
+.L.data.63:
+  .string "int x=3; int y=5; addx(&x, y);"
+.L.data.62:
+  .string "int x=3; int y=5; *(&y-1)=7; x;"
+.L.data.61:
+  .string "int x=3; int y=5; *(&x+1)=7; y;"
+.L.data.60:
+  .string "int x=3; int *y=&x; *y=5; x;"
+.L.data.59:
+  .string "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.data.58:
+  .string "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.data.57:
+  .string "int x=3; (&x+2)-&x;"
+.L.data.56:
+  .string "int x=3; int y=5; *(&y-1);"
+.L.data.55:
+  .string "int x=3; int y=5; *(&x + 1);"
+.L.data.54:
+  .string "int x=3; int y=5; *(&x+1);"
+.L.data.53:
+  .string "int x=3; int *y=&x; int **z=&y; **z;"
+.L.data.52:
+  .string "int x=3; *&x;"
+.L.data.51:
+  .string "fib(9)"
+.L.data.50:
+  .string "int x=1; add6(x, ..., add6(x, ...));"
+.L.data.49:
+  .string "int x=1; x+(x+(...(x+ret3())...));"
+.L.data.48:
+  .string "add6(1,2,3,4,5,6)"
+.L.data.47:
+  .string "sub(5, 3)"
+.L.data.46:
+  .string "add(3, 5)"
+.L.data.45:
+  .string "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.data.44:
+  .string "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.data.43:
+  .string "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.data.42:
+  .string "1; {2;} 3;"
+.L.data.41:
+  .string "int x=5; int y=0; for (; x; x=x-1) if (x>1) y=y+1; y;"
+.L.data.40:
+  .string "int x=3; int y=0; if (x!=3) y=1; else if (x==3) y=2; y;"
+.L.data.39:
+  .string "int x=0; if (2-1) x=2; else x=3; x;"
+.L.data.38:
+  .string "int x=0; if (1) x=2; else x=3; x;"
+.L.data.37:
+  .string "int x=0; if (1-1) x=2; else x=3; x;"
+.L.data.36:
+  .string "int x=0; if (0) x=2; else x=3; x;"
+.L.data.35:
+  .string "ret3();"
+.L.data.34:
+  .string "int foo123=3; int bar=5; foo123+bar;"
+.L.data.33:
+  .string "int foo=3; foo;"
+.L.data.32:
+  .string "int a=3; int z=5; a+z;"
+.L.data.31:
+  .string "int a=3; a;"
+.L.data.30:
+  .string "int a; int z; a=3; z=5; a+z;"
+.L.data.29:
+  .string "int a; a=3; a;"
+.L.data.28:
+  .string "1>=2"
+.L.data.27:
+  .string "1>=1"
+.L.data.26:
+  .string "1>=0"
+.L.data.25:
+  .string "1>2"
+.L.data.24:
+  .string "1>1"
+.L.data.23:
+  .string "1>0"
+.L.data.22:
+  .string "2<=1"
+.L.data.21:
+  .string "1<=1"
+.L.data.20:
+  .string "0<=1"
+.L.data.19:
+  .string "2<1"
+.L.data.18:
+  .string "1<1"
+.L.data.17:
+  .string "0<1"
+.L.data.16:
+  .string "42!=42"
+.L.data.15:
+  .string "0!=1"
+.L.data.14:
+  .string "42==42"
+.L.data.13:
+  .string "0==1"
+.L.data.12:
+  .string "- - +10"
+.L.data.11:
+  .string "- -10"
+.L.data.10:
+  .string "0"
+.L.data.9:
+  .string "(3+5)/2"
+.L.data.8:
+  .string "5*(9-6)"
+.L.data.7:
+  .string "0"
+.L.data.6:
+  .string " 12 + 34 - 5 "
+.L.data.5:
+  .string "0"
+.L.data.4:
+  .string "42"
+.L.data.3:
+  .string "0"
+.L.data.2:
+  .string "int a=3; int z=5; a+z;"
+.L.data.1:
+  .string "%s => %d expected but got %d\012"
+.L.data.0:
+  .string "%s => %d\012"
+g2:
+  .zero 32
+g1:
+  .zero 8
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, [rbp-24]
+  mov [rbp-32], rax
+  mov rax, [rbp-16]
+  mov [rbp-40], rax
+  mov rax, [rbp-32]
+  cmp rax, [rbp-40]
+  jne .L.assert.3
+.L.assert.2:
+  mov rax, offset .L.data.0
+  mov [rbp-32], rax
+  mov rax, [rbp-8]
+  mov [rbp-40], rax
+  mov rax, [rbp-16]
+  mov [rbp-48], rax
+  mov rdi, [rbp-32]
+  mov rsi, [rbp-40]
+  mov rdx, [rbp-48]
+  mov rax, 0
+  call printf
+  mov [rbp-32], rax
+  jmp .L.assert.4
+.L.assert.3:
+  mov rax, offset .L.data.1
+  mov [rbp-32], rax
+  mov rax, [rbp-8]
+  mov [rbp-40], rax
+  mov rax, [rbp-24]
+  mov [rbp-48], rax
+  mov rax, [rbp-16]
+  mov [rbp-56], rax
+  mov rdi, [rbp-32]
+  mov rsi, [rbp-40]
+  mov rdx, [rbp-48]
+  mov rcx, [rbp-56]
+  mov rax, 0
+  call printf
+  mov [rbp-32], rax
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  mov [rbp-32], rax
+.L.assert.4:
+  mov rax, 0
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, 3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  add rax, [rbp-32]
+  mov [rbp-24], rax
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  sub rax, [rbp-32]
+  mov [rbp-24], rax
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov [rbp-56], rax
+  mov rax, [rbp-40]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-32]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-24]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-16]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-8]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rax]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  add rax, [rbp-32]
+  mov [rbp-24], rax
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  mov [rbp-16], rax
+  movsx rax, byte ptr [rbp-2]
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  sub rax, [rbp-24]
+  mov [rbp-16], rax
+  movsx rax, byte ptr [rbp-1]
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  sub rax, [rbp-24]
+  mov [rbp-16], rax
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], rdi
+  mov rax, rdi
+  mov [rbp-16], rax
+  cmp rax, 1
+  jg  .L.fib.4
+.L.fib.2:
+  mov rax, 1
+  jmp .L.return.fib
+.L.fib.4:
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  sub rax, 1
+  mov [rbp-16], rax
+  mov rdi, rax
+  mov rax, 0
+  call fib
+  mov [rbp-16], rax
+  mov rax, [rbp-8]
+  mov [rbp-24], rax
+  sub rax, 2
+  mov [rbp-24], rax
+  mov rdi, rax
+  mov rax, 0
+  call fib
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  add rax, [rbp-24]
+  mov [rbp-16], rax
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, rdi
+  mov [rbp-16], rax
+  cmp rax, 1
+  jne .L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.4
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.2:
+  mov rax, 10
+  jmp .L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.4:
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  cmp rax, 2
+  jne .L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.7
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.5:
+  mov rax, 20
+  jmp .L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.7:
+  mov rax, 30
+.L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 3376
+  mov rdi, 3
+  mov [rbp-3300], rdi
+  mov rdi, 5
+  mov [rbp-3292], rdi
+  mov rax, [rbp-3300]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3292]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.2
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.3
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.4
+  mov [rbp-3312], rax
+  mov rdi, 42
+  mov rsi, 42
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.5
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.6
+  mov [rbp-3312], rax
+  mov rdi, 41
+  mov rsi, 41
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.7
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.8
+  mov [rbp-3312], rax
+  mov rdi, 15
+  mov rsi, 15
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.9
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.10
+  mov [rbp-3312], rax
+  mov rdi, -10
+  mov rsi, -10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.11
+  mov [rbp-3312], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.12
+  mov [rbp-3312], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.13
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.14
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.15
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.16
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.17
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.18
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.19
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.20
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.21
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.22
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.23
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.24
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.25
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.26
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.27
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.28
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3284], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.29
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3276], rdi
+  mov rdi, 5
+  mov [rbp-3268], rdi
+  mov rax, [rbp-3276]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3268]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.30
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3260], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.31
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3252], rdi
+  mov rdi, 5
+  mov [rbp-3244], rdi
+  mov rax, [rbp-3252]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3244]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.32
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3236], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.33
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3228], rdi
+  mov rdi, 5
+  mov [rbp-3220], rdi
+  mov rax, [rbp-3228]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3220]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.34
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.35
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3212], rdi
+.L.main.3:
+  mov rdi, 3
+  mov [rbp-3212], rdi
+.L.main.4:
+  mov rax, [rbp-3212]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.36
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3204], rdi
+.L.main.6:
+  mov rdi, 3
+  mov [rbp-3204], rdi
+.L.main.7:
+  mov rax, [rbp-3204]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.37
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3196], rdi
+.L.main.8:
+  mov rdi, 2
+  mov [rbp-3196], rdi
+.L.main.10:
+  mov rax, [rbp-3196]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.38
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3188], rdi
+.L.main.11:
+  mov rdi, 2
+  mov [rbp-3188], rdi
+.L.main.13:
+  mov rax, [rbp-3188]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.39
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3180], rdi
+  mov rdi, 0
+  mov [rbp-3172], rdi
+  mov rax, [rbp-3180]
+  mov [rbp-3312], rax
+  cmp rax, 3
+  je  .L.main.15
+.L.main.14:
+  mov rdi, 1
+  mov [rbp-3172], rdi
+  jmp .L.main.18
+.L.main.15:
+  mov rax, [rbp-3180]
+  mov [rbp-3312], rax
+  cmp rax, 3
+  jne .L.main.17
+.L.main.16:
+  mov rdi, 2
+  mov [rbp-3172], rdi
+.L.main.17:
+.L.main.18:
+  mov rax, [rbp-3172]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.40
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-3164], rdi
+  mov rdi, 0
+  mov [rbp-3156], rdi
+.L.main.19:
+  mov rax, [rbp-3164]
+  mov [rbp-3312], rax
+  cmp rax, 0
+  je  .L.main.23
+.L.main.20:
+  mov rax, [rbp-3164]
+  mov [rbp-3312], rax
+  mov rax, 1
+  cmp rax, [rbp-3312]
+  jge .L.main.22
+.L.main.21:
+  mov rax, [rbp-3156]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3156], rdi
+.L.main.22:
+  mov rax, [rbp-3164]
+  mov [rbp-3312], rax
+  sub rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3164], rdi
+  jmp .L.main.19
+.L.main.23:
+  mov rax, [rbp-3156]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.41
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.42
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3148], rdi
+  mov rdi, 0
+  mov [rbp-3148], rdi
+.L.main.24:
+  mov rax, [rbp-3148]
+  mov [rbp-3312], rax
+  cmp rax, 10
+  jge .L.main.26
+.L.main.25:
+  mov rax, [rbp-3148]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3148], rdi
+  jmp .L.main.24
+.L.main.26:
+  mov rax, [rbp-3148]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.43
+  mov [rbp-3320], rax
+  mov rdi, 10
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3140], rdi
+  mov rdi, 0
+  mov [rbp-3132], rdi
+.L.main.27:
+  mov rax, [rbp-3140]
+  mov [rbp-3312], rax
+  cmp rax, 10
+  jg  .L.main.29
+.L.main.28:
+  mov rax, [rbp-3140]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3132]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3132], rdi
+  mov rax, [rbp-3140]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3140], rdi
+  jmp .L.main.27
+.L.main.29:
+  mov rax, [rbp-3132]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.44
+  mov [rbp-3320], rax
+  mov rdi, 55
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3124], rdi
+  mov rdi, 0
+  mov [rbp-3116], rdi
+  mov rdi, 0
+  mov [rbp-3124], rdi
+.L.main.30:
+  mov rax, [rbp-3124]
+  mov [rbp-3312], rax
+  cmp rax, 10
+  jg  .L.main.32
+.L.main.31:
+  mov rax, [rbp-3124]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3116]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3116], rdi
+  mov rax, [rbp-3124]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3124], rdi
+  jmp .L.main.30
+.L.main.32:
+  mov rax, [rbp-3116]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.45
+  mov [rbp-3320], rax
+  mov rdi, 55
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-187], rdi
+  mov rdi, 5
+  mov [rbp-195], rdi
+  mov rax, [rbp-187]
+  mov [rbp-3312], rax
+  mov rax, [rbp-195]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.46
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-171], rdi
+  mov rdi, 3
+  mov [rbp-179], rdi
+  mov rax, [rbp-171]
+  mov [rbp-3312], rax
+  mov rax, [rbp-179]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  sub rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.47
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-123], rdi
+  mov rdi, 2
+  mov [rbp-131], rdi
+  mov rdi, 3
+  mov [rbp-139], rdi
+  mov rdi, 4
+  mov [rbp-147], rdi
+  mov rdi, 5
+  mov [rbp-155], rdi
+  mov rdi, 6
+  mov [rbp-163], rdi
+  mov rax, [rbp-123]
+  mov [rbp-3312], rax
+  mov rax, [rbp-131]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-139]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-147]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-155]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-163]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.48
+  mov [rbp-3320], rax
+  mov rdi, 21
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-3108], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3328], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3336], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3344], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3352], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3360], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3368], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3376], rax
+  add rax, 3
+  mov [rbp-3376], rax
+  mov rax, [rbp-3368]
+  add rax, [rbp-3376]
+  mov [rbp-3368], rax
+  mov rax, [rbp-3360]
+  add rax, [rbp-3368]
+  mov [rbp-3360], rax
+  mov rax, [rbp-3352]
+  add rax, [rbp-3360]
+  mov [rbp-3352], rax
+  mov rax, [rbp-3344]
+  add rax, [rbp-3352]
+  mov [rbp-3344], rax
+  mov rax, [rbp-3336]
+  add rax, [rbp-3344]
+  mov [rbp-3336], rax
+  mov rax, [rbp-3328]
+  add rax, [rbp-3336]
+  mov [rbp-3328], rax
+  mov rax, [rbp-3320]
+  add rax, [rbp-3328]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.49
+  mov [rbp-3320], rax
+  mov rdi, 12
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-3100], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-27], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-35], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 2
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-43], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 3
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-51], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 4
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-59], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-75], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-83], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-91], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-99], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-107], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-115], rdi
+  mov rax, [rbp-75]
+  mov [rbp-3312], rax
+  mov rax, [rbp-83]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-91]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-99]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-107]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-115]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-67], rdi
+  mov rax, [rbp-27]
+  mov [rbp-3312], rax
+  mov rax, [rbp-35]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-43]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-51]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-59]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-67]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.50
+  mov [rbp-3320], rax
+  mov rdi, 21
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.51
+  mov [rbp-3320], rax
+  mov rdi, 55
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3092], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.52
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3084], rdi
+  lea rdi, [rbp-3084]
+  mov [rbp-3076], rdi
+  lea rdi, [rbp-3076]
+  mov [rbp-3068], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.53
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3060], rdi
+  mov rdi, 5
+  mov [rbp-3052], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.54
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3044], rdi
+  mov rdi, 5
+  mov [rbp-3036], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.55
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3028], rdi
+  mov rdi, 5
+  mov [rbp-3020], rdi
+  mov rax, [rbp-3028]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.56
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3012], rdi
+  lea rax, [rbp-2996]
+  lea rdi, [rbp-3012]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.57
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3004], rdi
+  mov rdi, 5
+  mov [rbp-2996], rdi
+  lea rdi, [rbp-3004]
+  mov [rbp-2988], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.58
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2980], rdi
+  mov rdi, 5
+  mov [rbp-2972], rdi
+  lea rdi, [rbp-2972]
+  mov [rbp-2964], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  sub rax, 8
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.59
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2956], rdi
+  lea rdi, [rbp-2956]
+  mov [rbp-2948], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2956]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.60
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2940], rdi
+  mov rdi, 5
+  mov [rbp-2932], rdi
+  mov rdi, 7
+  mov [rbp-2932], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.61
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2924], rdi
+  mov rdi, 5
+  mov [rbp-2916], rdi
+  mov rdi, 7
+  mov [rbp-2924], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.62
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2908], rdi
+  mov rdi, 5
+  mov [rbp-2900], rdi
+  lea rdi, [rbp-2908]
+  mov [rbp-11], rdi
+  mov rax, [rbp-2900]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-19], rdi
+  mov rax, [rbp-11]
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, [rbp-19]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.63
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2892]
+  mov [rbp-2876], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2892]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.64
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2868], rdi
+  mov rdi, 4
+  mov [rbp-2860], rdi
+  mov rdi, 5
+  mov [rbp-2852], rdi
+  mov rax, [rbp-2868]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.65
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2844], rdi
+  mov rdi, 4
+  mov [rbp-2836], rdi
+  mov rdi, 5
+  mov [rbp-2828], rdi
+  mov rax, [rbp-2836]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.66
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2820], rdi
+  mov rdi, 4
+  mov [rbp-2812], rdi
+  mov rdi, 5
+  mov [rbp-2804], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.67
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2796]
+  mov [rbp-2748], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2796]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.68
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2740]
+  mov [rbp-2692], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2732]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.69
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2684]
+  mov [rbp-2636], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2668]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.70
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2628]
+  mov [rbp-2580], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2604]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.71
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2572]
+  mov [rbp-2524], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 32
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2540]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.72
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2516]
+  mov [rbp-2468], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 40
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2476]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.73
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2460]
+  mov [rbp-2412], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 48
+  mov [rbp-3312], rax
+  mov rdi, 6
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2412]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.74
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2404], rdi
+  mov rdi, 4
+  mov [rbp-2396], rdi
+  mov rdi, 5
+  mov [rbp-2388], rdi
+  mov rax, [rbp-2404]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.75
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2380], rdi
+  mov rdi, 4
+  mov [rbp-2372], rdi
+  mov rdi, 5
+  mov [rbp-2364], rdi
+  mov rax, [rbp-2372]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.76
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2356], rdi
+  mov rdi, 4
+  mov [rbp-2348], rdi
+  mov rdi, 5
+  mov [rbp-2340], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.77
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2332], rdi
+  mov rdi, 4
+  mov [rbp-2324], rdi
+  mov rdi, 5
+  mov [rbp-2316], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.78
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2308]
+  mov [rbp-2260], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2308]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.79
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2252]
+  mov [rbp-2204], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2244]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.80
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2196]
+  mov [rbp-2148], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2180]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.81
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2140]
+  mov [rbp-2092], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2116]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.82
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2084]
+  mov [rbp-2036], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 32
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2052]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.83
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2028]
+  mov [rbp-1980], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 40
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-1988]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.84
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1972]
+  mov [rbp-1924], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 48
+  mov [rbp-3312], rax
+  mov rdi, 6
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-1924]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.85
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.86
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.87
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.88
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.89
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.90
+  mov [rbp-3312], rax
+  mov rdi, 96
+  mov rsi, 96
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.91
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.92
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.93
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.94
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.95
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g1
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.96
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g1
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g1
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.97
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.98
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.99
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.100
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.101
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.102
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.103
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1284], dil
+  movsx rax, byte ptr [rbp-1284]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.104
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1283], dil
+  mov rdi, 2
+  mov [rbp-1282], dil
+  movsx rax, byte ptr [rbp-1283]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.105
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1281], dil
+  mov rdi, 2
+  mov [rbp-1280], dil
+  movsx rax, byte ptr [rbp-1280]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.106
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.107
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.108
+  mov [rbp-3312], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-1], dil
+  mov rdi, 3
+  mov [rbp-2], dil
+  mov rdi, 3
+  mov [rbp-3], dil
+  movsx rax, byte ptr [rbp-1]
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rbp-2]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  sub rax, [rbp-3320]
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rbp-3]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  sub rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.109
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.110
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.111
+  mov [rbp-3320], rax
+  mov rdi, 97
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.112
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.113
+  mov [rbp-3320], rax
+  mov rdi, 98
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.114
+  mov [rbp-3312], rax
+  add rax, 2
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.115
+  mov [rbp-3320], rax
+  mov rdi, 99
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.116
+  mov [rbp-3312], rax
+  add rax, 3
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.117
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.119
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.120
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.121
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.122
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.123
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.124
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.125
+  mov [rbp-3320], rax
+  mov rdi, 9
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.126
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.127
+  mov [rbp-3320], rax
+  mov rdi, 10
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.128
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.129
+  mov [rbp-3320], rax
+  mov rdi, 11
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.130
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.131
+  mov [rbp-3320], rax
+  mov rdi, 12
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.132
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.133
+  mov [rbp-3320], rax
+  mov rdi, 13
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.134
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.135
+  mov [rbp-3320], rax
+  mov rdi, 27
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.136
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.137
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.138
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.139
+  mov [rbp-3320], rax
+  mov rdi, 106
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.140
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.141
+  mov [rbp-3320], rax
+  mov rdi, 107
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.142
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.143
+  mov [rbp-3320], rax
+  mov rdi, 108
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.145
+  mov [rbp-3312], rax
+  mov rdi, 131
+  mov rsi, 131
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.146
+  mov [rbp-3312], rax
+  add rax, 129
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.147
+  mov [rbp-3320], rax
+  mov rdi, 122
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.149
+  mov [rbp-3312], rax
+  mov rdi, 1101
+  mov rsi, 1101
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.150
+  mov [rbp-3312], rax
+  add rax, 1100
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.151
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.152
+  mov [rbp-3312], rax
+  add rax, 1099
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.153
+  mov [rbp-3320], rax
+  mov rdi, 72
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov [rbp-1268], rdi
+  mov rdi, 3
+  mov [rbp-1260], rdi
+  mov rax, [rbp-1268]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.154
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov [rbp-1252], rdi
+  mov rdi, 3
+  mov [rbp-1244], rdi
+  mov rdi, 4
+  mov [rbp-1236], rdi
+  mov rax, [rbp-1252]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.155
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov [rbp-1228], rdi
+  mov rdi, 3
+  mov [rbp-1228], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.156
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1204]
+  mov [rbp-1180], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1220]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.157
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1156]
+  mov [rbp-1132], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1172]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.158
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1124], rdi
+  mov rdi, 2
+  mov [rbp-1116], rdi
+  mov rax, [rbp-1124]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.159
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1108], rdi
+  mov rdi, 2
+  mov [rbp-1100], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.160
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1092], dil
+  mov rdi, 2
+  mov [rbp-1091], rdi
+  mov rdi, 3
+  mov [rbp-1083], dil
+  movsx rax, byte ptr [rbp-1092]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.161
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1081], rdi
+  mov rdi, 2
+  mov [rbp-1081], rdi
+  mov rdi, 3
+  mov [rbp-1073], dil
+  mov rax, [rbp-1081]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.162
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1072], dil
+  mov rdi, 2
+  mov [rbp-1071], rdi
+  mov rdi, 3
+  mov [rbp-1063], dil
+  movsx rax, byte ptr [rbp-1063]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.163
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1062]
+  mov [rbp-1014], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-1062]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.164
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1006]
+  mov [rbp-958], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-998]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.165
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-950]
+  mov [rbp-902], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-934]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.166
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-894]
+  mov [rbp-846], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-870]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.167
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-838]
+  mov [rbp-774], rdi
+  mov rdi, 6
+  mov [rbp-838], rdi
+  mov rax, [rbp-774]
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.168
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-766]
+  mov [rbp-702], rdi
+  mov rdi, 7
+  mov [rbp-742], rdi
+  mov rax, [rbp-702]
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.169
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 6
+  mov [rbp-694], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.170
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.171
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.172
+  mov [rbp-3312], rax
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.173
+  mov [rbp-3312], rax
+  mov rdi, 24
+  mov rsi, 24
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.174
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.175
+  mov [rbp-3312], rax
+  mov rdi, 48
+  mov rsi, 48
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.176
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rsi, 2
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.177
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.178
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.179
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.180
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.181
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-547], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.182
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-539], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.183
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-531], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.184
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-523], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.185
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-515], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.186
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-507], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.187
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-499], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.188
+  mov [rbp-3320], rax
+  mov rdi, 56
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-491], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.189
+  mov [rbp-3320], rax
+  mov rdi, 56
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, -3
+  mov [rbp-483], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.190
+  mov [rbp-3320], rax
+  mov rdi, -24
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-475], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  imul rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.191
+  mov [rbp-3320], rax
+  mov rdi, 21
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-443], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.192
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-411], rdi
+  lea rdi, [rbp-411]
+  mov [rbp-403], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.193
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-395], rdi
+  mov rdi, 2
+  mov [rbp-387], rdi
+  mov rdi, 3
+  mov [rbp-379], rdi
+  mov rax, [rbp-395]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.194
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-371], rdi
+  mov rdi, 0
+  mov [rbp-363], rdi
+  mov rdi, 2
+  mov [rbp-355], rdi
+  mov rdi, 3
+  mov [rbp-347], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-363], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.195
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-339], rdi
+  mov rdi, 9
+  mov [rbp-275], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.196
+  mov [rbp-3320], rax
+  mov rdi, 9
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rax, [rbp-203]
+  lea rdi, [rbp-267]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.197
+  mov [rbp-3320], rax
+  mov rdi, 64
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, 0
+  call long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.198
+  mov [rbp-3320], rax
+  mov rdi, 20
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.199
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov rax, 0
+  call printf
+  mov [rbp-3312], rax
+  mov rax, 0
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,18 @@
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  sub rax, [rbp-32]
+  mov [rbp-24], rax
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
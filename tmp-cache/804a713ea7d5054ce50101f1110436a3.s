@@ -0,0 +1,42 @@
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov [rbp-56], rax
+  mov rax, [rbp-40]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-32]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-24]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-16]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-8]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,2618 @@
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 3376
+  mov rdi, 3
+  mov [rbp-3300], rdi
+  mov rdi, 5
+  mov [rbp-3292], rdi
+  mov rax, [rbp-3300]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3292]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.2
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.3
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.4
+  mov [rbp-3312], rax
+  mov rdi, 42
+  mov rsi, 42
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.5
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.6
+  mov [rbp-3312], rax
+  mov rdi, 41
+  mov rsi, 41
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.7
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.8
+  mov [rbp-3312], rax
+  mov rdi, 15
+  mov rsi, 15
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.9
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.10
+  mov [rbp-3312], rax
+  mov rdi, -10
+  mov rsi, -10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.11
+  mov [rbp-3312], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.12
+  mov [rbp-3312], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.13
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.14
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.15
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.16
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.17
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.18
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.19
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.20
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.21
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.22
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.23
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.24
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.25
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.26
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.27
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.28
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3284], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.29
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3276], rdi
+  mov rdi, 5
+  mov [rbp-3268], rdi
+  mov rax, [rbp-3276]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3268]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.30
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3260], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.31
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3252], rdi
+  mov rdi, 5
+  mov [rbp-3244], rdi
+  mov rax, [rbp-3252]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3244]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.32
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3236], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.33
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3228], rdi
+  mov rdi, 5
+  mov [rbp-3220], rdi
+  mov rax, [rbp-3228]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3220]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.34
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.35
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3212], rdi
+.L.main.3:
+  mov rdi, 3
+  mov [rbp-3212], rdi
+.L.main.4:
+  mov rax, [rbp-3212]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.36
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3204], rdi
+.L.main.6:
+  mov rdi, 3
+  mov [rbp-3204], rdi
+.L.main.7:
+  mov rax, [rbp-3204]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.37
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3196], rdi
+.L.main.8:
+  mov rdi, 2
+  mov [rbp-3196], rdi
+.L.main.10:
+  mov rax, [rbp-3196]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.38
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3188], rdi
+.L.main.11:
+  mov rdi, 2
+  mov [rbp-3188], rdi
+.L.main.13:
+  mov rax, [rbp-3188]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.39
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3180], rdi
+  mov rdi, 0
+  mov [rbp-3172], rdi
+  mov rax, [rbp-3180]
+  mov [rbp-3312], rax
+  cmp rax, 3
+  je  .L.main.15
+.L.main.14:
+  mov rdi, 1
+  mov [rbp-3172], rdi
+  jmp .L.main.18
+.L.main.15:
+  mov rax, [rbp-3180]
+  mov [rbp-3312], rax
+  cmp rax, 3
+  jne .L.main.17
+.L.main.16:
+  mov rdi, 2
+  mov [rbp-3172], rdi
+.L.main.17:
+.L.main.18:
+  mov rax, [rbp-3172]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.40
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-3164], rdi
+  mov rdi, 0
+  mov [rbp-3156], rdi
+.L.main.19:
+  mov rax, [rbp-3164]
+  mov [rbp-3312], rax
+  cmp rax, 0
+  je  .L.main.23
+.L.main.20:
+  mov rax, [rbp-3164]
+  mov [rbp-3312], rax
+  mov rax, 1
+  cmp rax, [rbp-3312]
+  jge .L.main.22
+.L.main.21:
+  mov rax, [rbp-3156]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3156], rdi
+.L.main.22:
+  mov rax, [rbp-3164]
+  mov [rbp-3312], rax
+  sub rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3164], rdi
+  jmp .L.main.19
+.L.main.23:
+  mov rax, [rbp-3156]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.41
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.42
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3148], rdi
+  mov rdi, 0
+  mov [rbp-3148], rdi
+.L.main.24:
+  mov rax, [rbp-3148]
+  mov [rbp-3312], rax
+  cmp rax, 10
+  jge .L.main.26
+.L.main.25:
+  mov rax, [rbp-3148]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3148], rdi
+  jmp .L.main.24
+.L.main.26:
+  mov rax, [rbp-3148]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.43
+  mov [rbp-3320], rax
+  mov rdi, 10
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3140], rdi
+  mov rdi, 0
+  mov [rbp-3132], rdi
+.L.main.27:
+  mov rax, [rbp-3140]
+  mov [rbp-3312], rax
+  cmp rax, 10
+  jg  .L.main.29
+.L.main.28:
+  mov rax, [rbp-3140]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3132]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3132], rdi
+  mov rax, [rbp-3140]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3140], rdi
+  jmp .L.main.27
+.L.main.29:
+  mov rax, [rbp-3132]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.44
+  mov [rbp-3320], rax
+  mov rdi, 55
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov [rbp-3124], rdi
+  mov rdi, 0
+  mov [rbp-3116], rdi
+  mov rdi, 0
+  mov [rbp-3124], rdi
+.L.main.30:
+  mov rax, [rbp-3124]
+  mov [rbp-3312], rax
+  cmp rax, 10
+  jg  .L.main.32
+.L.main.31:
+  mov rax, [rbp-3124]
+  mov [rbp-3312], rax
+  mov rax, [rbp-3116]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3116], rdi
+  mov rax, [rbp-3124]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-3124], rdi
+  jmp .L.main.30
+.L.main.32:
+  mov rax, [rbp-3116]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.45
+  mov [rbp-3320], rax
+  mov rdi, 55
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-187], rdi
+  mov rdi, 5
+  mov [rbp-195], rdi
+  mov rax, [rbp-187]
+  mov [rbp-3312], rax
+  mov rax, [rbp-195]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.46
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-171], rdi
+  mov rdi, 3
+  mov [rbp-179], rdi
+  mov rax, [rbp-171]
+  mov [rbp-3312], rax
+  mov rax, [rbp-179]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  sub rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.47
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-123], rdi
+  mov rdi, 2
+  mov [rbp-131], rdi
+  mov rdi, 3
+  mov [rbp-139], rdi
+  mov rdi, 4
+  mov [rbp-147], rdi
+  mov rdi, 5
+  mov [rbp-155], rdi
+  mov rdi, 6
+  mov [rbp-163], rdi
+  mov rax, [rbp-123]
+  mov [rbp-3312], rax
+  mov rax, [rbp-131]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-139]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-147]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-155]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-163]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.48
+  mov [rbp-3320], rax
+  mov rdi, 21
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-3108], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3328], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3336], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3344], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3352], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3360], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3368], rax
+  mov rax, [rbp-3108]
+  mov [rbp-3376], rax
+  add rax, 3
+  mov [rbp-3376], rax
+  mov rax, [rbp-3368]
+  add rax, [rbp-3376]
+  mov [rbp-3368], rax
+  mov rax, [rbp-3360]
+  add rax, [rbp-3368]
+  mov [rbp-3360], rax
+  mov rax, [rbp-3352]
+  add rax, [rbp-3360]
+  mov [rbp-3352], rax
+  mov rax, [rbp-3344]
+  add rax, [rbp-3352]
+  mov [rbp-3344], rax
+  mov rax, [rbp-3336]
+  add rax, [rbp-3344]
+  mov [rbp-3336], rax
+  mov rax, [rbp-3328]
+  add rax, [rbp-3336]
+  mov [rbp-3328], rax
+  mov rax, [rbp-3320]
+  add rax, [rbp-3328]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.49
+  mov [rbp-3320], rax
+  mov rdi, 12
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-3100], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-27], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-35], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 2
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-43], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 3
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-51], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  add rax, 4
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-59], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-75], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-83], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-91], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-99], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-107], rdi
+  mov rax, [rbp-3100]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-115], rdi
+  mov rax, [rbp-75]
+  mov [rbp-3312], rax
+  mov rax, [rbp-83]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-91]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-99]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-107]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-115]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-67], rdi
+  mov rax, [rbp-27]
+  mov [rbp-3312], rax
+  mov rax, [rbp-35]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-43]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-51]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-59]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, [rbp-67]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.50
+  mov [rbp-3320], rax
+  mov rdi, 21
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.51
+  mov [rbp-3320], rax
+  mov rdi, 55
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3092], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.52
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3084], rdi
+  lea rdi, [rbp-3084]
+  mov [rbp-3076], rdi
+  lea rdi, [rbp-3076]
+  mov [rbp-3068], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.53
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3060], rdi
+  mov rdi, 5
+  mov [rbp-3052], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.54
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3044], rdi
+  mov rdi, 5
+  mov [rbp-3036], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.55
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3028], rdi
+  mov rdi, 5
+  mov [rbp-3020], rdi
+  mov rax, [rbp-3028]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.56
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3012], rdi
+  lea rax, [rbp-2996]
+  lea rdi, [rbp-3012]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.57
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-3004], rdi
+  mov rdi, 5
+  mov [rbp-2996], rdi
+  lea rdi, [rbp-3004]
+  mov [rbp-2988], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.58
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2980], rdi
+  mov rdi, 5
+  mov [rbp-2972], rdi
+  lea rdi, [rbp-2972]
+  mov [rbp-2964], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  sub rax, 8
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.59
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2956], rdi
+  lea rdi, [rbp-2956]
+  mov [rbp-2948], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2956]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.60
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2940], rdi
+  mov rdi, 5
+  mov [rbp-2932], rdi
+  mov rdi, 7
+  mov [rbp-2932], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.61
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2924], rdi
+  mov rdi, 5
+  mov [rbp-2916], rdi
+  mov rdi, 7
+  mov [rbp-2924], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.62
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2908], rdi
+  mov rdi, 5
+  mov [rbp-2900], rdi
+  lea rdi, [rbp-2908]
+  mov [rbp-11], rdi
+  mov rax, [rbp-2900]
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-19], rdi
+  mov rax, [rbp-11]
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, [rbp-19]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  add rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.63
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2892]
+  mov [rbp-2876], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2892]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.64
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2868], rdi
+  mov rdi, 4
+  mov [rbp-2860], rdi
+  mov rdi, 5
+  mov [rbp-2852], rdi
+  mov rax, [rbp-2868]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.65
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2844], rdi
+  mov rdi, 4
+  mov [rbp-2836], rdi
+  mov rdi, 5
+  mov [rbp-2828], rdi
+  mov rax, [rbp-2836]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.66
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2820], rdi
+  mov rdi, 4
+  mov [rbp-2812], rdi
+  mov rdi, 5
+  mov [rbp-2804], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.67
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2796]
+  mov [rbp-2748], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2796]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.68
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2740]
+  mov [rbp-2692], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2732]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.69
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2684]
+  mov [rbp-2636], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2668]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.70
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2628]
+  mov [rbp-2580], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2604]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.71
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2572]
+  mov [rbp-2524], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 32
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2540]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.72
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2516]
+  mov [rbp-2468], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 40
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2476]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.73
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2460]
+  mov [rbp-2412], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 48
+  mov [rbp-3312], rax
+  mov rdi, 6
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2412]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.74
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2404], rdi
+  mov rdi, 4
+  mov [rbp-2396], rdi
+  mov rdi, 5
+  mov [rbp-2388], rdi
+  mov rax, [rbp-2404]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.75
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2380], rdi
+  mov rdi, 4
+  mov [rbp-2372], rdi
+  mov rdi, 5
+  mov [rbp-2364], rdi
+  mov rax, [rbp-2372]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.76
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2356], rdi
+  mov rdi, 4
+  mov [rbp-2348], rdi
+  mov rdi, 5
+  mov [rbp-2340], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.77
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov [rbp-2332], rdi
+  mov rdi, 4
+  mov [rbp-2324], rdi
+  mov rdi, 5
+  mov [rbp-2316], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.78
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2308]
+  mov [rbp-2260], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2308]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.79
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2252]
+  mov [rbp-2204], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2244]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.80
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2196]
+  mov [rbp-2148], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2180]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.81
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2140]
+  mov [rbp-2092], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2116]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.82
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2084]
+  mov [rbp-2036], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 32
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-2052]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.83
+  mov [rbp-3320], rax
+  mov rdi, 4
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-2028]
+  mov [rbp-1980], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 40
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-1988]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.84
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1972]
+  mov [rbp-1924], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 48
+  mov [rbp-3312], rax
+  mov rdi, 6
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-1924]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.85
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.86
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.87
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.88
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.89
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.90
+  mov [rbp-3312], rax
+  mov rdi, 96
+  mov rsi, 96
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.91
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.92
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.93
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.94
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.95
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g1
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.96
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g1
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g1
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.97
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.98
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.99
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.100
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset g2
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.101
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.102
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.103
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1284], dil
+  movsx rax, byte ptr [rbp-1284]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.104
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1283], dil
+  mov rdi, 2
+  mov [rbp-1282], dil
+  movsx rax, byte ptr [rbp-1283]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.105
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1281], dil
+  mov rdi, 2
+  mov [rbp-1280], dil
+  movsx rax, byte ptr [rbp-1280]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.106
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.107
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.108
+  mov [rbp-3312], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-1], dil
+  mov rdi, 3
+  mov [rbp-2], dil
+  mov rdi, 3
+  mov [rbp-3], dil
+  movsx rax, byte ptr [rbp-1]
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rbp-2]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  sub rax, [rbp-3320]
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rbp-3]
+  mov [rbp-3320], rax
+  mov rax, [rbp-3312]
+  sub rax, [rbp-3320]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.109
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.110
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.111
+  mov [rbp-3320], rax
+  mov rdi, 97
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.112
+  mov [rbp-3312], rax
+  add rax, 1
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.113
+  mov [rbp-3320], rax
+  mov rdi, 98
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.114
+  mov [rbp-3312], rax
+  add rax, 2
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.115
+  mov [rbp-3320], rax
+  mov rdi, 99
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.116
+  mov [rbp-3312], rax
+  add rax, 3
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.117
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.119
+  mov [rbp-3312], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.120
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.121
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.122
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.123
+  mov [rbp-3320], rax
+  mov rdi, 8
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.124
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.125
+  mov [rbp-3320], rax
+  mov rdi, 9
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.126
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.127
+  mov [rbp-3320], rax
+  mov rdi, 10
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.128
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.129
+  mov [rbp-3320], rax
+  mov rdi, 11
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.130
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.131
+  mov [rbp-3320], rax
+  mov rdi, 12
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.132
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.133
+  mov [rbp-3320], rax
+  mov rdi, 13
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.134
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.135
+  mov [rbp-3320], rax
+  mov rdi, 27
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.136
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.137
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.138
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.139
+  mov [rbp-3320], rax
+  mov rdi, 106
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.140
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.141
+  mov [rbp-3320], rax
+  mov rdi, 107
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.142
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.143
+  mov [rbp-3320], rax
+  mov rdi, 108
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.145
+  mov [rbp-3312], rax
+  mov rdi, 131
+  mov rsi, 131
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.146
+  mov [rbp-3312], rax
+  add rax, 129
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.147
+  mov [rbp-3320], rax
+  mov rdi, 122
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.149
+  mov [rbp-3312], rax
+  mov rdi, 1101
+  mov rsi, 1101
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.150
+  mov [rbp-3312], rax
+  add rax, 1100
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.151
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.152
+  mov [rbp-3312], rax
+  add rax, 1099
+  mov [rbp-3312], rax
+  movsx rax, byte ptr [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.153
+  mov [rbp-3320], rax
+  mov rdi, 72
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov [rbp-1268], rdi
+  mov rdi, 3
+  mov [rbp-1260], rdi
+  mov rax, [rbp-1268]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.154
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov [rbp-1252], rdi
+  mov rdi, 3
+  mov [rbp-1244], rdi
+  mov rdi, 4
+  mov [rbp-1236], rdi
+  mov rax, [rbp-1252]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.155
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov [rbp-1228], rdi
+  mov rdi, 3
+  mov [rbp-1228], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.156
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1204]
+  mov [rbp-1180], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1220]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.157
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1156]
+  mov [rbp-1132], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1172]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.158
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1124], rdi
+  mov rdi, 2
+  mov [rbp-1116], rdi
+  mov rax, [rbp-1124]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.159
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1108], rdi
+  mov rdi, 2
+  mov [rbp-1100], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.160
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1092], dil
+  mov rdi, 2
+  mov [rbp-1091], rdi
+  mov rdi, 3
+  mov [rbp-1083], dil
+  movsx rax, byte ptr [rbp-1092]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.161
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1081], rdi
+  mov rdi, 2
+  mov [rbp-1081], rdi
+  mov rdi, 3
+  mov [rbp-1073], dil
+  mov rax, [rbp-1081]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.162
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-1072], dil
+  mov rdi, 2
+  mov [rbp-1071], rdi
+  mov rdi, 3
+  mov [rbp-1063], dil
+  movsx rax, byte ptr [rbp-1063]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.163
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1062]
+  mov [rbp-1014], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-1062]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.164
+  mov [rbp-3320], rax
+  mov rdi, 0
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-1006]
+  mov [rbp-958], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 8
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-998]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.165
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-950]
+  mov [rbp-902], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 16
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-934]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.166
+  mov [rbp-3320], rax
+  mov rdi, 2
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-894]
+  mov [rbp-846], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rax, [rbp-3312]
+  mov [rax], rdi
+  mov rax, [rbp-870]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.167
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-838]
+  mov [rbp-774], rdi
+  mov rdi, 6
+  mov [rbp-838], rdi
+  mov rax, [rbp-774]
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.168
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rdi, [rbp-766]
+  mov [rbp-702], rdi
+  mov rdi, 7
+  mov [rbp-742], rdi
+  mov rax, [rbp-702]
+  mov [rbp-3312], rax
+  add rax, 24
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.169
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 6
+  mov [rbp-694], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.170
+  mov [rbp-3320], rax
+  mov rdi, 6
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.171
+  mov [rbp-3312], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.172
+  mov [rbp-3312], rax
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.173
+  mov [rbp-3312], rax
+  mov rdi, 24
+  mov rsi, 24
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.174
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.175
+  mov [rbp-3312], rax
+  mov rdi, 48
+  mov rsi, 48
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.176
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rsi, 2
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.177
+  mov [rbp-3312], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.178
+  mov [rbp-3312], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.179
+  mov [rbp-3312], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.180
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.181
+  mov [rbp-3312], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3312]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-547], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.182
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-539], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.183
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-531], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.184
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-523], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.185
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-515], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.186
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-507], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.187
+  mov [rbp-3320], rax
+  mov rdi, 7
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-499], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.188
+  mov [rbp-3320], rax
+  mov rdi, 56
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-491], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.189
+  mov [rbp-3320], rax
+  mov rdi, 56
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, -3
+  mov [rbp-483], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.190
+  mov [rbp-3320], rax
+  mov rdi, -24
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 7
+  mov [rbp-475], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  imul rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.191
+  mov [rbp-3320], rax
+  mov rdi, 21
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-443], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.192
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 5
+  mov [rbp-411], rdi
+  lea rdi, [rbp-411]
+  mov [rbp-403], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, [rax]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.193
+  mov [rbp-3320], rax
+  mov rdi, 5
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-395], rdi
+  mov rdi, 2
+  mov [rbp-387], rdi
+  mov rdi, 3
+  mov [rbp-379], rdi
+  mov rax, [rbp-395]
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.194
+  mov [rbp-3320], rax
+  mov rdi, 1
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-371], rdi
+  mov rdi, 0
+  mov [rbp-363], rdi
+  mov rdi, 2
+  mov [rbp-355], rdi
+  mov rdi, 3
+  mov [rbp-347], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov [rbp-363], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.195
+  mov [rbp-3320], rax
+  mov rdi, 3
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 1
+  mov [rbp-339], rdi
+  mov rdi, 9
+  mov [rbp-275], rdi
+  mov rax, rdi
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.196
+  mov [rbp-3320], rax
+  mov rdi, 9
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  lea rax, [rbp-203]
+  lea rdi, [rbp-267]
+  sub rax, rdi
+  mov [rbp-3312], rax
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3312], rax
+  shl rax, 3
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.197
+  mov [rbp-3320], rax
+  mov rdi, 64
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rdi, 2
+  mov rax, 0
+  call long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.198
+  mov [rbp-3320], rax
+  mov rdi, 20
+  mov rsi, [rbp-3312]
+  mov rdx, [rbp-3320]
+  mov rax, 0
+  call assert
+  mov [rbp-3312], rax
+  mov rax, offset .L.data.199
+  mov [rbp-3312], rax
+  mov rdi, rax
+  mov rax, 0
+  call printf
+  mov [rbp-3312], rax
+  mov rax, 0
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
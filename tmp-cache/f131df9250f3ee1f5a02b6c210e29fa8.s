@@ -0,0 +1,37 @@
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], rdi
+  mov rax, rdi
+  mov [rbp-16], rax
+  cmp rax, 1
+  jg  .L.fib.4
+.L.fib.2:
+  mov rax, 1
+  jmp .L.return.fib
+.L.fib.4:
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  sub rax, 1
+  mov [rbp-16], rax
+  mov rdi, rax
+  mov rax, 0
+  call fib
+  mov [rbp-16], rax
+  mov rax, [rbp-8]
+  mov [rbp-24], rax
+  sub rax, 2
+  mov [rbp-24], rax
+  mov rdi, rax
+  mov rax, 0
+  call fib
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  add rax, [rbp-24]
+  mov [rbp-16], rax
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
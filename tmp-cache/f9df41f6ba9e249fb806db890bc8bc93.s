@@ -0,0 +1,41 @@
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+  cmp rax, 1
+  jg  .L.fib.4
+.L.fib.2:
+  mov rax, 1
+  jmp .L.return.fib
+.L.fib.4:
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+  sub rax, 1
+  mov [rbp-16], rax
+  mov rdi, [rbp-16]
+  mov rax, 0
+  call fib
+  mov [rbp-16], rax
+  mov rax, [rbp-8]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+  sub rax, 2
+  mov [rbp-24], rax
+  mov rdi, [rbp-24]
+  mov rax, 0
+  call fib
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  add rax, [rbp-24]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
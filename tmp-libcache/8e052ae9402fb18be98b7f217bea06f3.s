@@ -0,0 +1,2591 @@
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 3200
+  mov rdi, 3
+  mov [rbp-3105], rdi
+  mov rdi, 5
+  mov [rbp-3097], rdi
+  mov rax, [rbp-3105]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3097]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.2
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.3
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.4
+  mov [rbp-3120], rax
+  mov rdi, 42
+  mov rsi, 42
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.5
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.6
+  mov [rbp-3120], rax
+  mov rdi, 41
+  mov rsi, 41
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.7
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.8
+  mov [rbp-3120], rax
+  mov rdi, 15
+  mov rsi, 15
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.9
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.10
+  mov [rbp-3120], rax
+  mov rdi, -10
+  mov rsi, -10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.11
+  mov [rbp-3120], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.12
+  mov [rbp-3120], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.13
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.14
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.15
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.16
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.17
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.18
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.19
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.20
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.21
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.22
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.23
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.24
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.25
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.26
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.27
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.28
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3089], rdi
+  mov rax, [rbp-3089]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.29
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3081], rdi
+  mov rdi, 5
+  mov [rbp-3073], rdi
+  mov rax, [rbp-3081]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3073]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.30
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3065], rdi
+  mov rax, [rbp-3065]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.31
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3057], rdi
+  mov rdi, 5
+  mov [rbp-3049], rdi
+  mov rax, [rbp-3057]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3049]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.32
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3041], rdi
+  mov rax, [rbp-3041]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.33
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3033], rdi
+  mov rdi, 5
+  mov [rbp-3025], rdi
+  mov rax, [rbp-3033]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3025]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.34
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, 0
+  call ret3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.35
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-3017], rdi
+.L.main.3:
+  mov rdi, 3
+  mov [rbp-3017], rdi
+.L.main.4:
+  mov rax, [rbp-3017]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.36
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-3009], rdi
+.L.main.6:
+  mov rdi, 3
+  mov [rbp-3009], rdi
+.L.main.7:
+  mov rax, [rbp-3009]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.37
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-3001], rdi
+.L.main.8:
+  mov rdi, 2
+  mov [rbp-3001], rdi
+.L.main.10:
+  mov rax, [rbp-3001]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.38
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2993], rdi
+.L.main.11:
+  mov rdi, 2
+  mov [rbp-2993], rdi
+.L.main.13:
+  mov rax, [rbp-2993]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.39
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2985], rdi
+  mov rdi, 0
+  mov [rbp-2977], rdi
+  mov rax, [rbp-2985]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 3
+  je  .L.main.15
+.L.main.14:
+  mov rdi, 1
+  mov [rbp-2977], rdi
+  jmp .L.main.18
+.L.main.15:
+  mov rax, [rbp-2985]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 3
+  jne .L.main.17
+.L.main.16:
+  mov rdi, 2
+  mov [rbp-2977], rdi
+.L.main.17:
+.L.main.18:
+  mov rax, [rbp-2977]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.40
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov [rbp-2969], rdi
+  mov rdi, 0
+  mov [rbp-2961], rdi
+.L.main.19:
+  mov rax, [rbp-2969]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 0
+  je  .L.main.23
+.L.main.20:
+  mov rax, [rbp-2969]
+  mov [rbp-3120], rax
+  mov rax, 1
+  cmp rax, [rbp-3120]
+  jge .L.main.22
+.L.main.21:
+  mov rax, [rbp-2961]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2961], rdi
+.L.main.22:
+  mov rax, [rbp-2969]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  sub rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2969], rdi
+  jmp .L.main.19
+.L.main.23:
+  mov rax, [rbp-2961]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.41
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.42
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2953], rdi
+  mov rdi, 0
+  mov [rbp-2953], rdi
+.L.main.24:
+  mov rax, [rbp-2953]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 10
+  jge .L.main.26
+.L.main.25:
+  mov rax, [rbp-2953]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2953], rdi
+  jmp .L.main.24
+.L.main.26:
+  mov rax, [rbp-2953]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.43
+  mov [rbp-3128], rax
+  mov rdi, 10
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2945], rdi
+  mov rdi, 0
+  mov [rbp-2937], rdi
+.L.main.27:
+  mov rax, [rbp-2945]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 10
+  jg  .L.main.29
+.L.main.28:
+  mov rax, [rbp-2945]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2937]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2937], rdi
+  mov rax, [rbp-2945]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2945], rdi
+  jmp .L.main.27
+.L.main.29:
+  mov rax, [rbp-2937]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.44
+  mov [rbp-3128], rax
+  mov rdi, 55
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2929], rdi
+  mov rdi, 0
+  mov [rbp-2921], rdi
+  mov rdi, 0
+  mov [rbp-2929], rdi
+.L.main.30:
+  mov rax, [rbp-2929]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 10
+  jg  .L.main.32
+.L.main.31:
+  mov rax, [rbp-2929]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2921]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2921], rdi
+  mov rax, [rbp-2929]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2929], rdi
+  jmp .L.main.30
+.L.main.32:
+  mov rax, [rbp-2921]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.45
+  mov [rbp-3128], rax
+  mov rdi, 55
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rsi, 5
+  mov rax, 0
+  call add2
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.46
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rsi, 3
+  mov rax, 0
+  call sub2
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.47
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 2
+  mov rdx, 3
+  mov rcx, 4
+  mov r8, 5
+  mov r9, 6
+  mov rax, 0
+  call add6
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.48
+  mov [rbp-3128], rax
+  mov rdi, 21
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-2913], rdi
+  mov rax, [rbp-2913]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3128], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3136], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3144], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3152], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3160], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3168], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3176], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3184], rax
+  mov rax, 0
+  call ret3
+  mov [rbp-3192], rax
+  mov rax, [rbp-3184]
+  add rax, [rbp-3192]
+  mov [rbp-3184], rax
+  mov rax, [rbp-3176]
+  add rax, [rbp-3184]
+  mov [rbp-3176], rax
+  mov rax, [rbp-3168]
+  add rax, [rbp-3176]
+  mov [rbp-3168], rax
+  mov rax, [rbp-3160]
+  add rax, [rbp-3168]
+  mov [rbp-3160], rax
+  mov rax, [rbp-3152]
+  add rax, [rbp-3160]
+  mov [rbp-3152], rax
+  mov rax, [rbp-3144]
+  add rax, [rbp-3152]
+  mov [rbp-3144], rax
+  mov rax, [rbp-3136]
+  add rax, [rbp-3144]
+  mov [rbp-3136], rax
+  mov rax, [rbp-3128]
+  add rax, [rbp-3136]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.49
+  mov [rbp-3128], rax
+  mov rdi, 12
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-2905], rdi
+  mov rax, [rbp-2905]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3128]
+  add rax, 1
+  mov [rbp-3128], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3136], rax
+  mov rax, [rbp-3136]
+  add rax, 2
+  mov [rbp-3136], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3144], rax
+  mov rax, [rbp-3144]
+  add rax, 3
+  mov [rbp-3144], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3152], rax
+  mov rax, [rbp-3152]
+  add rax, 4
+  mov [rbp-3152], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3160], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3168], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3176], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3184], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3192], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3200], rax
+  mov rdi, [rbp-3160]
+  mov rsi, [rbp-3168]
+  mov rdx, [rbp-3176]
+  mov rcx, [rbp-3184]
+  mov r8, [rbp-3192]
+  mov r9, [rbp-3200]
+  mov rax, 0
+  call add6
+  mov [rbp-3160], rax
+  mov rdi, [rbp-3120]
+  mov rsi, [rbp-3128]
+  mov rdx, [rbp-3136]
+  mov rcx, [rbp-3144]
+  mov r8, [rbp-3152]
+  mov r9, [rbp-3160]
+  mov rax, 0
+  call add6
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.50
+  mov [rbp-3128], rax
+  mov rdi, 21
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.51
+  mov [rbp-3128], rax
+  mov rdi, 55
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2897], rdi
+  mov rax, [rbp-2897]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.52
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2889], rdi
+  lea rdi, [rbp-2889]
+  mov [rbp-2881], rdi
+  lea rdi, [rbp-2881]
+  mov [rbp-2873], rdi
+  mov rax, [rbp-2873]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.53
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2865], rdi
+  mov rdi, 5
+  mov [rbp-2857], rdi
+  mov rax, [rbp-2857]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.54
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2849], rdi
+  mov rdi, 5
+  mov [rbp-2841], rdi
+  mov rax, [rbp-2841]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.55
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2833], rdi
+  mov rdi, 5
+  mov [rbp-2825], rdi
+  mov rax, [rbp-2833]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.56
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2817], rdi
+  lea rax, [rbp-2801]
+  lea rdi, [rbp-2817]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.57
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2809], rdi
+  mov rdi, 5
+  mov [rbp-2801], rdi
+  lea rdi, [rbp-2809]
+  mov [rbp-2793], rdi
+  mov rax, [rbp-2793]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.58
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2785], rdi
+  mov rdi, 5
+  mov [rbp-2777], rdi
+  lea rdi, [rbp-2777]
+  mov [rbp-2769], rdi
+  mov rax, [rbp-2769]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  sub rax, 8
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.59
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2761], rdi
+  lea rdi, [rbp-2761]
+  mov [rbp-2753], rdi
+  mov rax, [rbp-2753]
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2761]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.60
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2745], rdi
+  mov rdi, 5
+  mov [rbp-2737], rdi
+  mov rdi, 7
+  mov [rbp-2737], rdi
+  mov rax, [rbp-2737]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.61
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2729], rdi
+  mov rdi, 5
+  mov [rbp-2721], rdi
+  mov rdi, 7
+  mov [rbp-2729], rdi
+  mov rax, [rbp-2729]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.62
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2713], rdi
+  mov rdi, 5
+  mov [rbp-2705], rdi
+  mov rax, [rbp-2705]
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2713]
+  mov rsi, [rbp-3120]
+  mov rax, 0
+  call addx
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.63
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2697]
+  mov [rbp-2681], rdi
+  mov rax, [rbp-2681]
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2697]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.64
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2673], rdi
+  mov rdi, 4
+  mov [rbp-2665], rdi
+  mov rdi, 5
+  mov [rbp-2657], rdi
+  mov rax, [rbp-2673]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.65
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2649], rdi
+  mov rdi, 4
+  mov [rbp-2641], rdi
+  mov rdi, 5
+  mov [rbp-2633], rdi
+  mov rax, [rbp-2641]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.66
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2625], rdi
+  mov rdi, 4
+  mov [rbp-2617], rdi
+  mov rdi, 5
+  mov [rbp-2609], rdi
+  mov rax, [rbp-2609]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.67
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2601]
+  mov [rbp-2553], rdi
+  mov rax, [rbp-2553]
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2601]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.68
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2545]
+  mov [rbp-2497], rdi
+  mov rax, [rbp-2497]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2537]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.69
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2489]
+  mov [rbp-2441], rdi
+  mov rax, [rbp-2441]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2473]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.70
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2433]
+  mov [rbp-2385], rdi
+  mov rax, [rbp-2385]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2409]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.71
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2377]
+  mov [rbp-2329], rdi
+  mov rax, [rbp-2329]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 32
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2345]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.72
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2321]
+  mov [rbp-2273], rdi
+  mov rax, [rbp-2273]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 40
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2281]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.73
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2265]
+  mov [rbp-2217], rdi
+  mov rax, [rbp-2217]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 48
+  mov [rbp-3120], rax
+  mov rdi, 6
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2217]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.74
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2209], rdi
+  mov rdi, 4
+  mov [rbp-2201], rdi
+  mov rdi, 5
+  mov [rbp-2193], rdi
+  mov rax, [rbp-2209]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.75
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2185], rdi
+  mov rdi, 4
+  mov [rbp-2177], rdi
+  mov rdi, 5
+  mov [rbp-2169], rdi
+  mov rax, [rbp-2177]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.76
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2161], rdi
+  mov rdi, 4
+  mov [rbp-2153], rdi
+  mov rdi, 5
+  mov [rbp-2145], rdi
+  mov rax, [rbp-2145]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.77
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2137], rdi
+  mov rdi, 4
+  mov [rbp-2129], rdi
+  mov rdi, 5
+  mov [rbp-2121], rdi
+  mov rax, [rbp-2121]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.78
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2113]
+  mov [rbp-2065], rdi
+  mov rax, [rbp-2065]
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2113]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.79
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2057]
+  mov [rbp-2009], rdi
+  mov rax, [rbp-2009]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2049]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.80
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2001]
+  mov [rbp-1953], rdi
+  mov rax, [rbp-1953]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1985]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.81
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1945]
+  mov [rbp-1897], rdi
+  mov rax, [rbp-1897]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1921]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.82
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1889]
+  mov [rbp-1841], rdi
+  mov rax, [rbp-1841]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 32
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1857]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.83
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1833]
+  mov [rbp-1785], rdi
+  mov rax, [rbp-1785]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 40
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1793]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.84
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1777]
+  mov [rbp-1729], rdi
+  mov rax, [rbp-1729]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 48
+  mov [rbp-3120], rax
+  mov rdi, 6
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1729]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.85
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.86
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.87
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.88
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.89
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.90
+  mov [rbp-3120], rax
+  mov rdi, 96
+  mov rsi, 96
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.91
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.92
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.93
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.94
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.95
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g1
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.96
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g1
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g1
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.97
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.98
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.99
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.100
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.101
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.102
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.103
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-1089], dil
+  movsx rax, byte ptr [rbp-1089]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.104
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-1088], dil
+  mov rdi, 2
+  mov [rbp-1087], dil
+  movsx rax, byte ptr [rbp-1088]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.105
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-1086], dil
+  mov rdi, 2
+  mov [rbp-1085], dil
+  movsx rax, byte ptr [rbp-1085]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.106
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.107
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.108
+  mov [rbp-3120], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov rsi, 3
+  mov rdx, 3
+  mov rax, 0
+  call sub_char
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.109
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.110
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.111
+  mov [rbp-3128], rax
+  mov rdi, 97
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.112
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.113
+  mov [rbp-3128], rax
+  mov rdi, 98
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.114
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.115
+  mov [rbp-3128], rax
+  mov rdi, 99
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.116
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 3
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.117
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.119
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.120
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.121
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.122
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.123
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.124
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.125
+  mov [rbp-3128], rax
+  mov rdi, 9
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.126
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.127
+  mov [rbp-3128], rax
+  mov rdi, 10
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.128
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.129
+  mov [rbp-3128], rax
+  mov rdi, 11
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.130
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.131
+  mov [rbp-3128], rax
+  mov rdi, 12
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.132
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.133
+  mov [rbp-3128], rax
+  mov rdi, 13
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.134
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.135
+  mov [rbp-3128], rax
+  mov rdi, 27
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.136
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.137
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.138
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.139
+  mov [rbp-3128], rax
+  mov rdi, 106
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.140
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.141
+  mov [rbp-3128], rax
+  mov rdi, 107
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.142
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.143
+  mov [rbp-3128], rax
+  mov rdi, 108
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.145
+  mov [rbp-3120], rax
+  mov rdi, 131
+  mov rsi, 131
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.146
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 129
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.147
+  mov [rbp-3128], rax
+  mov rdi, 122
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.149
+  mov [rbp-3120], rax
+  mov rdi, 1101
+  mov rsi, 1101
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.150
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1100
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.151
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.152
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1099
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.153
+  mov [rbp-3128], rax
+  mov rdi, 72
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov [rbp-1073], rdi
+  mov rdi, 3
+  mov [rbp-1065], rdi
+  mov rax, [rbp-1073]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.154
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov [rbp-1057], rdi
+  mov rdi, 3
+  mov [rbp-1049], rdi
+  mov rdi, 4
+  mov [rbp-1041], rdi
+  mov rax, [rbp-1057]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.155
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov [rbp-1033], rdi
+  mov rdi, 3
+  mov [rbp-1033], rdi
+  mov rax, [rbp-1033]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.156
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1009]
+  mov [rbp-985], rdi
+  mov rax, [rbp-985]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  lea rdi, [rbp-1025]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.157
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-961]
+  mov [rbp-937], rdi
+  mov rax, [rbp-937]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  lea rdi, [rbp-977]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.158
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-929], rdi
+  mov rdi, 2
+  mov [rbp-921], rdi
+  mov rax, [rbp-929]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.159
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-913], rdi
+  mov rdi, 2
+  mov [rbp-905], rdi
+  mov rax, [rbp-905]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.160
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-897], dil
+  mov rdi, 2
+  mov [rbp-896], rdi
+  mov rdi, 3
+  mov [rbp-888], dil
+  movsx rax, byte ptr [rbp-897]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.161
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-886], rdi
+  mov rdi, 2
+  mov [rbp-886], rdi
+  mov rdi, 3
+  mov [rbp-878], dil
+  mov rax, [rbp-886]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.162
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-877], dil
+  mov rdi, 2
+  mov [rbp-876], rdi
+  mov rdi, 3
+  mov [rbp-868], dil
+  movsx rax, byte ptr [rbp-868]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.163
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-867]
+  mov [rbp-819], rdi
+  mov rax, [rbp-819]
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-867]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.164
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-811]
+  mov [rbp-763], rdi
+  mov rax, [rbp-763]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-803]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.165
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-755]
+  mov [rbp-707], rdi
+  mov rax, [rbp-707]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-739]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.166
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-699]
+  mov [rbp-651], rdi
+  mov rax, [rbp-651]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-675]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.167
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-643]
+  mov [rbp-579], rdi
+  mov rdi, 6
+  mov [rbp-643], rdi
+  mov rax, [rbp-579]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.168
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-571]
+  mov [rbp-507], rdi
+  mov rdi, 7
+  mov [rbp-547], rdi
+  mov rax, [rbp-507]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.169
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 6
+  mov [rbp-499], rdi
+  mov rax, [rbp-499]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.170
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.171
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.172
+  mov [rbp-3120], rax
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.173
+  mov [rbp-3120], rax
+  mov rdi, 24
+  mov rsi, 24
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.174
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.175
+  mov [rbp-3120], rax
+  mov rdi, 48
+  mov rsi, 48
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.176
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rsi, 2
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.177
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.178
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.179
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.180
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.181
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-352], rdi
+  mov rax, [rbp-352]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.182
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-344], rdi
+  mov rax, [rbp-344]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.183
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-336], rdi
+  mov rax, [rbp-336]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.184
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-328], rdi
+  mov rax, [rbp-328]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.185
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-320], rdi
+  mov rax, [rbp-320]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.186
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-312], rdi
+  mov rax, [rbp-312]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.187
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-304], rdi
+  mov rax, [rbp-304]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.188
+  mov [rbp-3128], rax
+  mov rdi, 56
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-296], rdi
+  mov rax, [rbp-296]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.189
+  mov [rbp-3128], rax
+  mov rdi, 56
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, -3
+  mov [rbp-288], rdi
+  mov rax, [rbp-288]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.190
+  mov [rbp-3128], rax
+  mov rdi, -24
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-280], rdi
+  mov rax, [rbp-280]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  imul rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.191
+  mov [rbp-3128], rax
+  mov rdi, 21
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov [rbp-248], rdi
+  mov rax, [rbp-248]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.192
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov [rbp-216], rdi
+  lea rdi, [rbp-216]
+  mov [rbp-208], rdi
+  mov rax, [rbp-208]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.193
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-200], rdi
+  mov rdi, 2
+  mov [rbp-192], rdi
+  mov rdi, 3
+  mov [rbp-184], rdi
+  mov rax, [rbp-200]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.194
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-176], rdi
+  mov rdi, 0
+  mov [rbp-168], rdi
+  mov rdi, 2
+  mov [rbp-160], rdi
+  mov rdi, 3
+  mov [rbp-152], rdi
+  mov rax, [rbp-152]
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-168], rdi
+  mov rax, [rbp-168]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.195
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-144], rdi
+  mov rdi, 9
+  mov [rbp-80], rdi
+  mov rax, [rbp-80]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.196
+  mov [rbp-3128], rax
+  mov rdi, 9
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rax, [rbp-8]
+  lea rdi, [rbp-72]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.197
+  mov [rbp-3128], rax
+  mov rdi, 64
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, 0
+  call long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.198
+  mov [rbp-3128], rax
+  mov rdi, 20
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.199
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov rax, 0
+  call printf
+  mov [rbp-3120], rax
+  mov rax, 0
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,55 @@
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, [rbp-24]
+  mov [rbp-32], rax
+  mov rax, [rbp-16]
+  mov [rbp-40], rax
+  mov rax, [rbp-32]
+  cmp rax, [rbp-40]
+  jne .L.assert.3
+.L.assert.2:
+  mov rax, offset .L.data.0
+  mov [rbp-32], rax
+  mov rax, [rbp-8]
+  mov [rbp-40], rax
+  mov rax, [rbp-16]
+  mov [rbp-48], rax
+  mov rdi, [rbp-32]
+  mov rsi, [rbp-40]
+  mov rdx, [rbp-48]
+  mov rax, 0
+  call printf
+  mov [rbp-32], rax
+  jmp .L.assert.4
+.L.assert.3:
+  mov rax, offset .L.data.1
+  mov [rbp-32], rax
+  mov rax, [rbp-8]
+  mov [rbp-40], rax
+  mov rax, [rbp-24]
+  mov [rbp-48], rax
+  mov rax, [rbp-16]
+  mov [rbp-56], rax
+  mov rdi, [rbp-32]
+  mov rsi, [rbp-40]
+  mov rdx, [rbp-48]
+  mov rcx, [rbp-56]
+  mov rax, 0
+  call printf
+  mov [rbp-32], rax
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  mov [rbp-32], rax
+.L.assert.4:
+  mov rax, 0
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
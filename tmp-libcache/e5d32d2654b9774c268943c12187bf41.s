@@ -0,0 +1,19 @@
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  add rax, [rbp-32]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,25 @@
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  mov [rbp-16], rax
+  movsx rax, byte ptr [rbp-2]
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  sub rax, [rbp-24]
+  mov [rbp-16], rax
+  movsx rax, byte ptr [rbp-1]
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  sub rax, [rbp-24]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,2709 @@
+.intel_syntax noprefix
+.data
+.L.data.199:
+  .string "OK\012"
+.L.data.198:
+  .string "long function name"
+.L.data.197:
+  .string "&x.i - &x.a"
+.L.data.196:
+  .string "struct {int a; ... int i;} x; x.a=1; x.i=9; x.i;"
+.L.data.195:
+  .string "int x=1; int y=0; { int x=2; { int x=3; y=x; } } y;"
+.L.data.194:
+  .string "int x=1; { int x=2; { int x=3; } } x;"
+.L.data.193:
+  .string "int x[4]; x[3]=5; int *p=x+3; *(p-0);"
+.L.data.192:
+  .string "int x[4]; x[3]=5; *(x+4-1);"
+.L.data.191:
+  .string "int x=7; x*3;"
+.L.data.190:
+  .string "int x=-3; x*8;"
+.L.data.189:
+  .string "int x=7; 8*x;"
+.L.data.188:
+  .string "int x=7; x*8;"
+.L.data.187:
+  .string "int x=7; x/1;"
+.L.data.186:
+  .string "int x=7; x-0;"
+.L.data.185:
+  .string "int x=7; 0+x;"
+.L.data.184:
+  .string "int x=7; x+0;"
+.L.data.183:
+  .string "int x=7; 1*x;"
+.L.data.182:
+  .string "int x=7; x*1;"
+.L.data.181:
+  .string "1+2<3"
+.L.data.180:
+  .string "2*3==6"
+.L.data.179:
+  .string "7/2"
+.L.data.178:
+  .string "4*8"
+.L.data.177:
+  .string "struct {char a; int b;} x; sizeof(x);"
+.L.data.176:
+  .string "struct {char a; char b;} x; sizeof(x);"
+.L.data.175:
+  .string "struct {int a[3];} x[2]; sizeof(x)};"
+.L.data.174:
+  .string "struct {int a;} x[4]; sizeof(x);"
+.L.data.173:
+  .string "struct {int a[3];} x; sizeof(x);"
+.L.data.172:
+  .string "struct {int a; int b;} x; sizeof(x);"
+.L.data.171:
+  .string "struct {int a;} x; sizeof(x);"
+.L.data.170:
+  .string "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.data.169:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.data.168:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.data.167:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.data.166:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.data.165:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.data.164:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.data.163:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.data.162:
+  .string "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.data.161:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.data.160:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.data.159:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.data.158:
+  .string "int x[5]; int *y=x+2; y-x;"
+.L.data.157:
+  .string "int x[5]; int *y = x + 2; y - x;"
+.L.data.156:
+  .string "int x=2; { x=3; } x;"
+.L.data.155:
+  .string "int x=2; { int x=3; } int y=4; x;"
+.L.data.154:
+  .string "int x=2; { int x=3; } x;"
+.L.data.153:
+  .string "1100-byte string[1099]"
+.L.data.152:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.151:
+  .string "1100-byte string[1100]"
+.L.data.150:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.149:
+  .string "sizeof(1100-byte string)"
+.L.data.148:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.147:
+  .string "130-byte string[129]"
+.L.data.146:
+  .ascii "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl"
+  .ascii "mnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwx"
+  .string "yz"
+.L.data.145:
+  .string "sizeof(130-byte string)"
+.L.data.144:
+  .ascii "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl"
+  .ascii "mnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwx"
+  .string "yz"
+.L.data.143:
+  .string "\"\\l\"[0]"
+.L.data.142:
+  .string "l"
+.L.data.141:
+  .string "\"\\k\"[0]"
+.L.data.140:
+  .string "k"
+.L.data.139:
+  .string "\"\\j\"[0]"
+.L.data.138:
+  .string "j"
+.L.data.137:
+  .string "\"\\0\"[0]"
+.L.data.136:
+  .string "\000"
+.L.data.135:
+  .string "\"\\e\"[0]"
+.L.data.134:
+  .string "\033"
+.L.data.133:
+  .string "\"\\r\"[0]"
+.L.data.132:
+  .string "\015"
+.L.data.131:
+  .string "\"\\f\"[0]"
+.L.data.130:
+  .string "\014"
+.L.data.129:
+  .string "\"\\v\"[0]"
+.L.data.128:
+  .string "\013"
+.L.data.127:
+  .string "\"\\n\"[0]"
+.L.data.126:
+  .string "\012"
+.L.data.125:
+  .string "\"\\t\"[0]"
+.L.data.124:
+  .string "\011"
+.L.data.123:
+  .string "\"\\b\"[0]"
+.L.data.122:
+  .string "\010"
+.L.data.121:
+  .string "\"\\a\"[0]"
+.L.data.120:
+  .string "\007"
+.L.data.119:
+  .string "sizeof(\"abc\")"
+.L.data.118:
+  .string "abc"
+.L.data.117:
+  .string "\"abc\"[3]"
+.L.data.116:
+  .string "abc"
+.L.data.115:
+  .string "\"abc\"[2]"
+.L.data.114:
+  .string "abc"
+.L.data.113:
+  .string "\"abc\"[1]"
+.L.data.112:
+  .string "abc"
+.L.data.111:
+  .string "\"abc\"[0]"
+.L.data.110:
+  .string "abc"
+.L.data.109:
+  .string "sub_char(7, 3, 3)"
+.L.data.108:
+  .string "char x[10]; sizeof(x);"
+.L.data.107:
+  .string "char x; sizeof(x);"
+.L.data.106:
+  .string "char x=1; char y=2; y;"
+.L.data.105:
+  .string "char x=1; char y=2; x;"
+.L.data.104:
+  .string "char x=1; x;"
+.L.data.103:
+  .string "sizeof(g2)"
+.L.data.102:
+  .string "sizeof(g1)"
+.L.data.101:
+  .string "g2[3]"
+.L.data.100:
+  .string "g2[2]"
+.L.data.99:
+  .string "g2[1]"
+.L.data.98:
+  .string "g2[0]"
+.L.data.97:
+  .string "g1"
+.L.data.96:
+  .string "g1"
+.L.data.95:
+  .string "int x[3][4]; sizeof(**x + 1);"
+.L.data.94:
+  .string "int x[3][4]; sizeof **x + 1;"
+.L.data.93:
+  .string "int x[3][4]; sizeof(**x) + 1;"
+.L.data.92:
+  .string "int x[3][4]; sizeof(**x);"
+.L.data.91:
+  .string "int x[3][4]; sizeof(*x);"
+.L.data.90:
+  .string "int x[3][4]; sizeof(x);"
+.L.data.89:
+  .string "int x[4]; sizeof(x);"
+.L.data.88:
+  .string "int *x; sizeof(x);"
+.L.data.87:
+  .string "int x; sizeof x;"
+.L.data.86:
+  .string "int x; sizeof(x);"
+.L.data.85:
+  .string "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.data.84:
+  .string "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.data.83:
+  .string "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.data.82:
+  .string "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.data.81:
+  .string "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.data.80:
+  .string "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.data.79:
+  .string "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.data.78:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.77:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.76:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.data.75:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.data.74:
+  .string "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.data.73:
+  .string "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.data.72:
+  .string "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.data.71:
+  .string "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.data.70:
+  .string "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.data.69:
+  .string "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.data.68:
+  .string "int x[2][3]; int *y=x; *y=0; **x;"
+.L.data.67:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.data.66:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.data.65:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.data.64:
+  .string "int x[2]; int *y=&x; *y=3; *x;"
+.L.data.63:
+  .string "int x=3; int y=5; addx(&x, y);"
+.L.data.62:
+  .string "int x=3; int y=5; *(&y-1)=7; x;"
+.L.data.61:
+  .string "int x=3; int y=5; *(&x+1)=7; y;"
+.L.data.60:
+  .string "int x=3; int *y=&x; *y=5; x;"
+.L.data.59:
+  .string "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.data.58:
+  .string "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.data.57:
+  .string "int x=3; (&x+2)-&x;"
+.L.data.56:
+  .string "int x=3; int y=5; *(&y-1);"
+.L.data.55:
+  .string "int x=3; int y=5; *(&x + 1);"
+.L.data.54:
+  .string "int x=3; int y=5; *(&x+1);"
+.L.data.53:
+  .string "int x=3; int *y=&x; int **z=&y; **z;"
+.L.data.52:
+  .string "int x=3; *&x;"
+.L.data.51:
+  .string "fib(9)"
+.L.data.50:
+  .string "int x=1; add6(x, ..., add6(x, ...));"
+.L.data.49:
+  .string "int x=1; x+(x+(...(x+ret3())...));"
+.L.data.48:
+  .string "add6(1,2,3,4,5,6)"
+.L.data.47:
+  .string "sub(5, 3)"
+.L.data.46:
+  .string "add(3, 5)"
+.L.data.45:
+  .string "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.data.44:
+  .string "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.data.43:
+  .string "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.data.42:
+  .string "1; {2;} 3;"
+.L.data.41:
+  .string "int x=5; int y=0; for (; x; x=x-1) if (x>1) y=y+1; y;"
+.L.data.40:
+  .string "int x=3; int y=0; if (x!=3) y=1; else if (x==3) y=2; y;"
+.L.data.39:
+  .string "int x=0; if (2-1) x=2; else x=3; x;"
+.L.data.38:
+  .string "int x=0; if (1) x=2; else x=3; x;"
+.L.data.37:
+  .string "int x=0; if (1-1) x=2; else x=3; x;"
+.L.data.36:
+  .string "int x=0; if (0) x=2; else x=3; x;"
+.L.data.35:
+  .string "ret3();"
+.L.data.34:
+  .string "int foo123=3; int bar=5; foo123+bar;"
+.L.data.33:
+  .string "int foo=3; foo;"
+.L.data.32:
+  .string "int a=3; int z=5; a+z;"
+.L.data.31:
+  .string "int a=3; a;"
+.L.data.30:
+  .string "int a; int z; a=3; z=5; a+z;"
+.L.data.29:
+  .string "int a; a=3; a;"
+.L.data.28:
+  .string "1>=2"
+.L.data.27:
+  .string "1>=1"
+.L.data.26:
+  .string "1>=0"
+.L.data.25:
+  .string "1>2"
+.L.data.24:
+  .string "1>1"
+.L.data.23:
+  .string "1>0"
+.L.data.22:
+  .string "2<=1"
+.L.data.21:
+  .string "1<=1"
+.L.data.20:
+  .string "0<=1"
+.L.data.19:
+  .string "2<1"
+.L.data.18:
+  .string "1<1"
+.L.data.17:
+  .string "0<1"
+.L.data.16:
+  .string "42!=42"
+.L.data.15:
+  .string "0!=1"
+.L.data.14:
+  .string "42==42"
+.L.data.13:
+  .string "0==1"
+.L.data.12:
+  .string "- - +10"
+.L.data.11:
+  .string "- -10"
+.L.data.10:
+  .string "0"
+.L.data.9:
+  .string "(3+5)/2"
+.L.data.8:
+  .string "5*(9-6)"
+.L.data.7:
+  .string "0"
+.L.data.6:
+  .string " 12 + 34 - 5 "
+.L.data.5:
+  .string "0"
+.L.data.4:
+  .string "42"
+.L.data.3:
+  .string "0"
+.L.data.2:
+  .string "int a=3; int z=5; a+z;"
+.L.data.1:
+  .string "%s => %d expected but got %d\012"
+.L.data.0:
+  .string "%s => %d\012"
+g2:
+  .zero 32
+g1:
+  .zero 8
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-32], rbx
+  mov [rbp-40], r12
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov r10, [rbp-24]
+  mov r11, [rbp-16]
+  cmp r10, r11
+  jne .L.assert.3
+.L.assert.2:
+  mov r10, offset .L.data.0
+  mov r11, [rbp-8]
+  mov rbx, [rbp-16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rax, 0
+  call printf
+  mov r10, rax
+  jmp .L.assert.4
+.L.assert.3:
+  mov r10, offset .L.data.1
+  mov r11, [rbp-8]
+  mov rbx, [rbp-24]
+  mov r12, [rbp-16]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, rbx
+  mov rcx, r12
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  mov r10, rax
+.L.assert.4:
+  mov rax, 0
+.L.return.assert:
+  mov rbx, [rbp-32]
+  mov r12, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, 3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r11, [rbp-8]
+  sub r10, r11
+  mov rax, r10
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov r10, [rbp-48]
+  mov r11, [rbp-40]
+  add r10, r11
+  mov r11, [rbp-32]
+  add r10, r11
+  mov r11, [rbp-24]
+  add r10, r11
+  mov r11, [rbp-16]
+  add r10, r11
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov r10, [rbp-16]
+  mov r10, [r10]
+  mov r11, [rbp-8]
+  add r10, r11
+  mov rax, r10
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx r10, byte ptr [rbp-3]
+  movsx r11, byte ptr [rbp-2]
+  sub r10, r11
+  movsx r11, byte ptr [rbp-1]
+  sub r10, r11
+  mov rax, r10
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rbx
+  mov [rbp-8], rdi
+  mov r10, [rbp-8]
+  cmp r10, 1
+  jg  .L.fib.4
+.L.fib.2:
+  mov rax, 1
+  jmp .L.return.fib
+.L.fib.4:
+  mov r10, [rbp-8]
+  sub r10, 1
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov rbx, rax
+  mov r10, [rbp-8]
+  sub r10, 2
+  mov rdi, r10
+  mov rax, 0
+  call fib
+  mov r10, rax
+  add rbx, r10
+  mov rax, rbx
+.L.return.fib:
+  mov rbx, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov r10, [rbp-8]
+  cmp r10, 1
+  jne .L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.4
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.2:
+  mov rax, 10
+  jmp .L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.4:
+  mov r10, [rbp-8]
+  cmp r10, 2
+  jne .L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.7
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.5:
+  mov rax, 20
+  jmp .L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.7:
+  mov rax, 30
+.L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 3184
+  mov [rbp-3152], rbx
+  mov [rbp-3160], r12
+  mov [rbp-3168], r13
+  mov [rbp-3176], r14
+  mov [rbp-3184], r15
+  mov rdi, 3
+  mov [rbp-3105], rdi
+  mov rdi, 5
+  mov [rbp-3097], rdi
+  mov r10, [rbp-3105]
+  mov r11, [rbp-3097]
+  add r10, r11
+  mov r11, offset .L.data.2
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.3
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.4
+  mov rdi, 42
+  mov rsi, 42
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.5
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.6
+  mov rdi, 41
+  mov rsi, 41
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.7
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.8
+  mov rdi, 15
+  mov rsi, 15
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.9
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.10
+  mov rdi, -10
+  mov rsi, -10
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.11
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.12
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.13
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.14
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.15
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.16
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.17
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.18
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.19
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.20
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.21
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.22
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.23
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.24
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.25
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.26
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.27
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.28
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-3089], rdi
+  mov r10, [rbp-3089]
+  mov r11, offset .L.data.29
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-3081], rdi
+  mov rdi, 5
+  mov [rbp-3073], rdi
+  mov r10, [rbp-3081]
+  mov r11, [rbp-3073]
+  add r10, r11
+  mov r11, offset .L.data.30
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-3065], rdi
+  mov r10, [rbp-3065]
+  mov r11, offset .L.data.31
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-3057], rdi
+  mov rdi, 5
+  mov [rbp-3049], rdi
+  mov r10, [rbp-3057]
+  mov r11, [rbp-3049]
+  add r10, r11
+  mov r11, offset .L.data.32
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-3041], rdi
+  mov r10, [rbp-3041]
+  mov r11, offset .L.data.33
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-3033], rdi
+  mov rdi, 5
+  mov [rbp-3025], rdi
+  mov r10, [rbp-3033]
+  mov r11, [rbp-3025]
+  add r10, r11
+  mov r11, offset .L.data.34
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rax, 0
+  call ret3
+  mov r10, rax
+  mov r11, offset .L.data.35
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-3017], rdi
+.L.main.3:
+  mov rdi, 3
+  mov [rbp-3017], rdi
+.L.main.4:
+  mov r10, [rbp-3017]
+  mov r11, offset .L.data.36
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-3009], rdi
+.L.main.6:
+  mov rdi, 3
+  mov [rbp-3009], rdi
+.L.main.7:
+  mov r10, [rbp-3009]
+  mov r11, offset .L.data.37
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-3001], rdi
+.L.main.8:
+  mov rdi, 2
+  mov [rbp-3001], rdi
+.L.main.10:
+  mov r10, [rbp-3001]
+  mov r11, offset .L.data.38
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-2993], rdi
+.L.main.11:
+  mov rdi, 2
+  mov [rbp-2993], rdi
+.L.main.13:
+  mov r10, [rbp-2993]
+  mov r11, offset .L.data.39
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2985], rdi
+  mov rdi, 0
+  mov [rbp-2977], rdi
+  mov r10, [rbp-2985]
+  cmp r10, 3
+  je  .L.main.15
+.L.main.14:
+  mov rdi, 1
+  mov [rbp-2977], rdi
+  jmp .L.main.18
+.L.main.15:
+  mov r10, [rbp-2985]
+  cmp r10, 3
+  jne .L.main.17
+.L.main.16:
+  mov rdi, 2
+  mov [rbp-2977], rdi
+.L.main.17:
+.L.main.18:
+  mov r10, [rbp-2977]
+  mov r11, offset .L.data.40
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 5
+  mov [rbp-2969], rdi
+  mov rdi, 0
+  mov [rbp-2961], rdi
+.L.main.19:
+  mov r10, [rbp-2969]
+  cmp r10, 0
+  je  .L.main.23
+.L.main.20:
+  mov r10, [rbp-2969]
+  mov rax, 1
+  cmp rax, r10
+  jge .L.main.22
+.L.main.21:
+  mov r10, [rbp-2961]
+  add r10, 1
+  mov [rbp-2961], r10
+.L.main.22:
+  mov r10, [rbp-2969]
+  sub r10, 1
+  mov [rbp-2969], r10
+  jmp .L.main.19
+.L.main.23:
+  mov r10, [rbp-2961]
+  mov r11, offset .L.data.41
+  mov rdi, 4
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.42
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-2953], rdi
+  mov rdi, 0
+  mov [rbp-2953], rdi
+.L.main.24:
+  mov r10, [rbp-2953]
+  cmp r10, 10
+  jge .L.main.26
+.L.main.25:
+  mov r10, [rbp-2953]
+  add r10, 1
+  mov [rbp-2953], r10
+  jmp .L.main.24
+.L.main.26:
+  mov r10, [rbp-2953]
+  mov r11, offset .L.data.43
+  mov rdi, 10
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-2945], rdi
+  mov rdi, 0
+  mov [rbp-2937], rdi
+.L.main.27:
+  mov r10, [rbp-2945]
+  cmp r10, 10
+  jg  .L.main.29
+.L.main.28:
+  mov r10, [rbp-2945]
+  mov r11, [rbp-2937]
+  add r10, r11
+  mov [rbp-2937], r10
+  mov r10, [rbp-2945]
+  add r10, 1
+  mov [rbp-2945], r10
+  jmp .L.main.27
+.L.main.29:
+  mov r10, [rbp-2937]
+  mov r11, offset .L.data.44
+  mov rdi, 55
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 0
+  mov [rbp-2929], rdi
+  mov rdi, 0
+  mov [rbp-2921], rdi
+  mov rdi, 0
+  mov [rbp-2929], rdi
+.L.main.30:
+  mov r10, [rbp-2929]
+  cmp r10, 10
+  jg  .L.main.32
+.L.main.31:
+  mov r10, [rbp-2929]
+  mov r11, [rbp-2921]
+  add r10, r11
+  mov [rbp-2921], r10
+  mov r10, [rbp-2929]
+  add r10, 1
+  mov [rbp-2929], r10
+  jmp .L.main.30
+.L.main.32:
+  mov r10, [rbp-2921]
+  mov r11, offset .L.data.45
+  mov rdi, 55
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov rsi, 5
+  mov rax, 0
+  call add2
+  mov r10, rax
+  mov r11, offset .L.data.46
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 5
+  mov rsi, 3
+  mov rax, 0
+  call sub2
+  mov r10, rax
+  mov r11, offset .L.data.47
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov rsi, 2
+  mov rdx, 3
+  mov rcx, 4
+  mov r8, 5
+  mov r9, 6
+  mov rax, 0
+  call add6
+  mov r10, rax
+  mov r11, offset .L.data.48
+  mov rdi, 21
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-2913], rdi
+  mov rax, [rbp-2913]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3128], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3136], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3144], rax
+  mov r15, [rbp-2913]
+  mov rbx, [rbp-2913]
+  mov r12, [rbp-2913]
+  mov r13, [rbp-2913]
+  mov r14, [rbp-2913]
+  mov rax, 0
+  call ret3
+  mov r10, rax
+  add r14, r10
+  add r13, r14
+  add r12, r13
+  add rbx, r12
+  add r15, rbx
+  mov r14, [rbp-3144]
+  add r14, r15
+  mov r13, [rbp-3136]
+  add r13, r14
+  mov r12, [rbp-3128]
+  add r12, r13
+  mov rbx, [rbp-3120]
+  add rbx, r12
+  mov r10, offset .L.data.49
+  mov rdi, 12
+  mov rsi, rbx
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-2905], rdi
+  mov rbx, [rbp-2905]
+  mov r10, [rbp-2905]
+  mov rax, r10
+  add rax, 1
+  mov [rbp-3120], rax
+  mov r10, [rbp-2905]
+  mov rax, r10
+  add rax, 2
+  mov [rbp-3128], rax
+  mov r10, [rbp-2905]
+  mov rax, r10
+  add rax, 3
+  mov [rbp-3136], rax
+  mov r10, [rbp-2905]
+  mov rax, r10
+  add rax, 4
+  mov [rbp-3144], rax
+  mov r10, [rbp-2905]
+  mov r11, [rbp-2905]
+  mov r15, [rbp-2905]
+  mov r14, [rbp-2905]
+  mov r13, [rbp-2905]
+  mov r12, [rbp-2905]
+  mov rdi, r10
+  mov rsi, r11
+  mov rdx, r15
+  mov rcx, r14
+  mov r8, r13
+  mov r9, r12
+  mov rax, 0
+  call add6
+  mov r10, rax
+  mov rdi, rbx
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rcx, [rbp-3136]
+  mov r8, [rbp-3144]
+  mov r9, r10
+  mov rax, 0
+  call add6
+  mov r10, rax
+  mov r11, offset .L.data.50
+  mov rdi, 21
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov r10, rax
+  mov r11, offset .L.data.51
+  mov rdi, 55
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2897], rdi
+  mov r10, [rbp-2897]
+  mov r11, offset .L.data.52
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2889], rdi
+  lea rdi, [rbp-2889]
+  mov [rbp-2881], rdi
+  lea rdi, [rbp-2881]
+  mov [rbp-2873], rdi
+  mov r10, [rbp-2873]
+  mov r10, [r10]
+  mov r10, [r10]
+  mov r11, offset .L.data.53
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2865], rdi
+  mov rdi, 5
+  mov [rbp-2857], rdi
+  mov r10, [rbp-2857]
+  mov r11, offset .L.data.54
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2849], rdi
+  mov rdi, 5
+  mov [rbp-2841], rdi
+  mov r10, [rbp-2841]
+  mov r11, offset .L.data.55
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2833], rdi
+  mov rdi, 5
+  mov [rbp-2825], rdi
+  mov r10, [rbp-2833]
+  mov r11, offset .L.data.56
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2817], rdi
+  lea r10, [rbp-2801]
+  lea rdi, [rbp-2817]
+  sub r10, rdi
+  mov rax, r10
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov r10, rax
+  mov r11, offset .L.data.57
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2809], rdi
+  mov rdi, 5
+  mov [rbp-2801], rdi
+  lea rdi, [rbp-2809]
+  mov [rbp-2793], rdi
+  mov r10, [rbp-2793]
+  add r10, 8
+  mov r10, [r10]
+  mov r11, offset .L.data.58
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2785], rdi
+  mov rdi, 5
+  mov [rbp-2777], rdi
+  lea rdi, [rbp-2777]
+  mov [rbp-2769], rdi
+  mov r10, [rbp-2769]
+  sub r10, 8
+  mov r10, [r10]
+  mov r11, offset .L.data.59
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2761], rdi
+  lea rdi, [rbp-2761]
+  mov [rbp-2753], rdi
+  mov r10, [rbp-2753]
+  mov rdi, 5
+  mov [r10], rdi
+  mov r10, [rbp-2761]
+  mov r11, offset .L.data.60
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2745], rdi
+  mov rdi, 5
+  mov [rbp-2737], rdi
+  mov rdi, 7
+  mov [rbp-2737], rdi
+  mov r10, [rbp-2737]
+  mov r11, offset .L.data.61
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2729], rdi
+  mov rdi, 5
+  mov [rbp-2721], rdi
+  mov rdi, 7
+  mov [rbp-2729], rdi
+  mov r10, [rbp-2729]
+  mov r11, offset .L.data.62
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2713], rdi
+  mov rdi, 5
+  mov [rbp-2705], rdi
+  mov r10, [rbp-2705]
+  lea rdi, [rbp-2713]
+  mov rsi, r10
+  mov rax, 0
+  call addx
+  mov r10, rax
+  mov r11, offset .L.data.63
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2697]
+  mov [rbp-2681], rdi
+  mov r10, [rbp-2681]
+  mov rdi, 3
+  mov [r10], rdi
+  mov r10, [rbp-2697]
+  mov r11, offset .L.data.64
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2673], rdi
+  mov rdi, 4
+  mov [rbp-2665], rdi
+  mov rdi, 5
+  mov [rbp-2657], rdi
+  mov r10, [rbp-2673]
+  mov r11, offset .L.data.65
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2649], rdi
+  mov rdi, 4
+  mov [rbp-2641], rdi
+  mov rdi, 5
+  mov [rbp-2633], rdi
+  mov r10, [rbp-2641]
+  mov r11, offset .L.data.66
+  mov rdi, 4
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2625], rdi
+  mov rdi, 4
+  mov [rbp-2617], rdi
+  mov rdi, 5
+  mov [rbp-2609], rdi
+  mov r10, [rbp-2609]
+  mov r11, offset .L.data.67
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2601]
+  mov [rbp-2553], rdi
+  mov r10, [rbp-2553]
+  mov rdi, 0
+  mov [r10], rdi
+  mov r10, [rbp-2601]
+  mov r11, offset .L.data.68
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2545]
+  mov [rbp-2497], rdi
+  mov r10, [rbp-2497]
+  add r10, 8
+  mov rdi, 1
+  mov [r10], rdi
+  mov r10, [rbp-2537]
+  mov r11, offset .L.data.69
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2489]
+  mov [rbp-2441], rdi
+  mov r10, [rbp-2441]
+  add r10, 16
+  mov rdi, 2
+  mov [r10], rdi
+  mov r10, [rbp-2473]
+  mov r11, offset .L.data.70
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2433]
+  mov [rbp-2385], rdi
+  mov r10, [rbp-2385]
+  add r10, 24
+  mov rdi, 3
+  mov [r10], rdi
+  mov r10, [rbp-2409]
+  mov r11, offset .L.data.71
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2377]
+  mov [rbp-2329], rdi
+  mov r10, [rbp-2329]
+  add r10, 32
+  mov rdi, 4
+  mov [r10], rdi
+  mov r10, [rbp-2345]
+  mov r11, offset .L.data.72
+  mov rdi, 4
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2321]
+  mov [rbp-2273], rdi
+  mov r10, [rbp-2273]
+  add r10, 40
+  mov rdi, 5
+  mov [r10], rdi
+  mov r10, [rbp-2281]
+  mov r11, offset .L.data.73
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2265]
+  mov [rbp-2217], rdi
+  mov r10, [rbp-2217]
+  add r10, 48
+  mov rdi, 6
+  mov [r10], rdi
+  mov r10, [rbp-2217]
+  mov r11, offset .L.data.74
+  mov rdi, 6
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2209], rdi
+  mov rdi, 4
+  mov [rbp-2201], rdi
+  mov rdi, 5
+  mov [rbp-2193], rdi
+  mov r10, [rbp-2209]
+  mov r11, offset .L.data.75
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2185], rdi
+  mov rdi, 4
+  mov [rbp-2177], rdi
+  mov rdi, 5
+  mov [rbp-2169], rdi
+  mov r10, [rbp-2177]
+  mov r11, offset .L.data.76
+  mov rdi, 4
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2161], rdi
+  mov rdi, 4
+  mov [rbp-2153], rdi
+  mov rdi, 5
+  mov [rbp-2145], rdi
+  mov r10, [rbp-2145]
+  mov r11, offset .L.data.77
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 3
+  mov [rbp-2137], rdi
+  mov rdi, 4
+  mov [rbp-2129], rdi
+  mov rdi, 5
+  mov [rbp-2121], rdi
+  mov r10, [rbp-2121]
+  mov r11, offset .L.data.78
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2113]
+  mov [rbp-2065], rdi
+  mov r10, [rbp-2065]
+  mov rdi, 0
+  mov [r10], rdi
+  mov r10, [rbp-2113]
+  mov r11, offset .L.data.79
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2057]
+  mov [rbp-2009], rdi
+  mov r10, [rbp-2009]
+  add r10, 8
+  mov rdi, 1
+  mov [r10], rdi
+  mov r10, [rbp-2049]
+  mov r11, offset .L.data.80
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-2001]
+  mov [rbp-1953], rdi
+  mov r10, [rbp-1953]
+  add r10, 16
+  mov rdi, 2
+  mov [r10], rdi
+  mov r10, [rbp-1985]
+  mov r11, offset .L.data.81
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-1945]
+  mov [rbp-1897], rdi
+  mov r10, [rbp-1897]
+  add r10, 24
+  mov rdi, 3
+  mov [r10], rdi
+  mov r10, [rbp-1921]
+  mov r11, offset .L.data.82
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-1889]
+  mov [rbp-1841], rdi
+  mov r10, [rbp-1841]
+  add r10, 32
+  mov rdi, 4
+  mov [r10], rdi
+  mov r10, [rbp-1857]
+  mov r11, offset .L.data.83
+  mov rdi, 4
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-1833]
+  mov [rbp-1785], rdi
+  mov r10, [rbp-1785]
+  add r10, 40
+  mov rdi, 5
+  mov [r10], rdi
+  mov r10, [rbp-1793]
+  mov r11, offset .L.data.84
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-1777]
+  mov [rbp-1729], rdi
+  mov r10, [rbp-1729]
+  add r10, 48
+  mov rdi, 6
+  mov [r10], rdi
+  mov r10, [rbp-1729]
+  mov r11, offset .L.data.85
+  mov rdi, 6
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.86
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.87
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.88
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.89
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.90
+  mov rdi, 96
+  mov rsi, 96
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.91
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.92
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.93
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.94
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.95
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g1
+  mov r10, [r10]
+  mov r11, offset .L.data.96
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g1
+  mov rdi, 3
+  mov [r10], rdi
+  mov r10, offset g1
+  mov r10, [r10]
+  mov r11, offset .L.data.97
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g2
+  mov rdi, 0
+  mov [r10], rdi
+  mov r10, offset g2
+  add r10, 8
+  mov rdi, 1
+  mov [r10], rdi
+  mov r10, offset g2
+  add r10, 16
+  mov rdi, 2
+  mov [r10], rdi
+  mov r10, offset g2
+  add r10, 24
+  mov rdi, 3
+  mov [r10], rdi
+  mov r10, offset g2
+  mov r10, [r10]
+  mov r11, offset .L.data.98
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g2
+  add r10, 8
+  mov r10, [r10]
+  mov r11, offset .L.data.99
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g2
+  add r10, 16
+  mov r10, [r10]
+  mov r11, offset .L.data.100
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset g2
+  add r10, 24
+  mov r10, [r10]
+  mov r11, offset .L.data.101
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.102
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.103
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-1089], dil
+  movsx r10, byte ptr [rbp-1089]
+  mov r11, offset .L.data.104
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-1088], dil
+  mov rdi, 2
+  mov [rbp-1087], dil
+  movsx r10, byte ptr [rbp-1088]
+  mov r11, offset .L.data.105
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-1086], dil
+  mov rdi, 2
+  mov [rbp-1085], dil
+  movsx r10, byte ptr [rbp-1085]
+  mov r11, offset .L.data.106
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.107
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.108
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov rsi, 3
+  mov rdx, 3
+  mov rax, 0
+  call sub_char
+  mov r10, rax
+  mov r11, offset .L.data.109
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.110
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.111
+  mov rdi, 97
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.112
+  add r10, 1
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.113
+  mov rdi, 98
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.114
+  add r10, 2
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.115
+  mov rdi, 99
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.116
+  add r10, 3
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.117
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.119
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.120
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.121
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.122
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.123
+  mov rdi, 8
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.124
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.125
+  mov rdi, 9
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.126
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.127
+  mov rdi, 10
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.128
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.129
+  mov rdi, 11
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.130
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.131
+  mov rdi, 12
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.132
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.133
+  mov rdi, 13
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.134
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.135
+  mov rdi, 27
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.136
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.137
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.138
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.139
+  mov rdi, 106
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.140
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.141
+  mov rdi, 107
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.142
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.143
+  mov rdi, 108
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.145
+  mov rdi, 131
+  mov rsi, 131
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.146
+  add r10, 129
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.147
+  mov rdi, 122
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.149
+  mov rdi, 1101
+  mov rsi, 1101
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.150
+  add r10, 1100
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.151
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.152
+  add r10, 1099
+  movsx r10, byte ptr [r10]
+  mov r11, offset .L.data.153
+  mov rdi, 72
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 2
+  mov [rbp-1073], rdi
+  mov rdi, 3
+  mov [rbp-1065], rdi
+  mov r10, [rbp-1073]
+  mov r11, offset .L.data.154
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 2
+  mov [rbp-1057], rdi
+  mov rdi, 3
+  mov [rbp-1049], rdi
+  mov rdi, 4
+  mov [rbp-1041], rdi
+  mov r10, [rbp-1057]
+  mov r11, offset .L.data.155
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 2
+  mov [rbp-1033], rdi
+  mov rdi, 3
+  mov [rbp-1033], rdi
+  mov r10, [rbp-1033]
+  mov r11, offset .L.data.156
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-1009]
+  mov [rbp-985], rdi
+  mov r10, [rbp-985]
+  lea rdi, [rbp-1025]
+  sub r10, rdi
+  mov rax, r10
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov r10, rax
+  mov r11, offset .L.data.157
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-961]
+  mov [rbp-937], rdi
+  mov r10, [rbp-937]
+  lea rdi, [rbp-977]
+  sub r10, rdi
+  mov rax, r10
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov r10, rax
+  mov r11, offset .L.data.158
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-929], rdi
+  mov rdi, 2
+  mov [rbp-921], rdi
+  mov r10, [rbp-929]
+  mov r11, offset .L.data.159
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-913], rdi
+  mov rdi, 2
+  mov [rbp-905], rdi
+  mov r10, [rbp-905]
+  mov r11, offset .L.data.160
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-897], dil
+  mov rdi, 2
+  mov [rbp-896], rdi
+  mov rdi, 3
+  mov [rbp-888], dil
+  movsx r10, byte ptr [rbp-897]
+  mov r11, offset .L.data.161
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-886], rdi
+  mov rdi, 2
+  mov [rbp-886], rdi
+  mov rdi, 3
+  mov [rbp-878], dil
+  mov r10, [rbp-886]
+  mov r11, offset .L.data.162
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-877], dil
+  mov rdi, 2
+  mov [rbp-876], rdi
+  mov rdi, 3
+  mov [rbp-868], dil
+  movsx r10, byte ptr [rbp-868]
+  mov r11, offset .L.data.163
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-867]
+  mov [rbp-819], rdi
+  mov r10, [rbp-819]
+  mov rdi, 0
+  mov [r10], rdi
+  mov r10, [rbp-867]
+  mov r11, offset .L.data.164
+  mov rdi, 0
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-811]
+  mov [rbp-763], rdi
+  mov r10, [rbp-763]
+  add r10, 8
+  mov rdi, 1
+  mov [r10], rdi
+  mov r10, [rbp-803]
+  mov r11, offset .L.data.165
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-755]
+  mov [rbp-707], rdi
+  mov r10, [rbp-707]
+  add r10, 16
+  mov rdi, 2
+  mov [r10], rdi
+  mov r10, [rbp-739]
+  mov r11, offset .L.data.166
+  mov rdi, 2
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-699]
+  mov [rbp-651], rdi
+  mov r10, [rbp-651]
+  add r10, 24
+  mov rdi, 3
+  mov [r10], rdi
+  mov r10, [rbp-675]
+  mov r11, offset .L.data.167
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-643]
+  mov [rbp-579], rdi
+  mov rdi, 6
+  mov [rbp-643], rdi
+  mov r10, [rbp-579]
+  mov r10, [r10]
+  mov r11, offset .L.data.168
+  mov rdi, 6
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea rdi, [rbp-571]
+  mov [rbp-507], rdi
+  mov rdi, 7
+  mov [rbp-547], rdi
+  mov r10, [rbp-507]
+  add r10, 24
+  mov r10, [r10]
+  mov r11, offset .L.data.169
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 6
+  mov [rbp-499], rdi
+  mov r10, [rbp-499]
+  mov r11, offset .L.data.170
+  mov rdi, 6
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.171
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.172
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.173
+  mov rdi, 24
+  mov rsi, 24
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.174
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.175
+  mov rdi, 48
+  mov rsi, 48
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.176
+  mov rdi, 2
+  mov rsi, 2
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.177
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.178
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.179
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.180
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.181
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, r10
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-352], rdi
+  mov r10, [rbp-352]
+  mov r11, offset .L.data.182
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-344], rdi
+  mov r10, [rbp-344]
+  mov r11, offset .L.data.183
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-336], rdi
+  mov r10, [rbp-336]
+  mov r11, offset .L.data.184
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-328], rdi
+  mov r10, [rbp-328]
+  mov r11, offset .L.data.185
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-320], rdi
+  mov r10, [rbp-320]
+  mov r11, offset .L.data.186
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-312], rdi
+  mov r10, [rbp-312]
+  mov r11, offset .L.data.187
+  mov rdi, 7
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-304], rdi
+  mov r10, [rbp-304]
+  shl r10, 3
+  mov r11, offset .L.data.188
+  mov rdi, 56
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-296], rdi
+  mov r10, [rbp-296]
+  shl r10, 3
+  mov r11, offset .L.data.189
+  mov rdi, 56
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, -3
+  mov [rbp-288], rdi
+  mov r10, [rbp-288]
+  shl r10, 3
+  mov r11, offset .L.data.190
+  mov rdi, -24
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 7
+  mov [rbp-280], rdi
+  mov r10, [rbp-280]
+  imul r10, 3
+  mov r11, offset .L.data.191
+  mov rdi, 21
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 5
+  mov [rbp-248], rdi
+  mov r10, [rbp-248]
+  mov r11, offset .L.data.192
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 5
+  mov [rbp-216], rdi
+  lea rdi, [rbp-216]
+  mov [rbp-208], rdi
+  mov r10, [rbp-208]
+  mov r10, [r10]
+  mov r11, offset .L.data.193
+  mov rdi, 5
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-200], rdi
+  mov rdi, 2
+  mov [rbp-192], rdi
+  mov rdi, 3
+  mov [rbp-184], rdi
+  mov r10, [rbp-200]
+  mov r11, offset .L.data.194
+  mov rdi, 1
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-176], rdi
+  mov rdi, 0
+  mov [rbp-168], rdi
+  mov rdi, 2
+  mov [rbp-160], rdi
+  mov rdi, 3
+  mov [rbp-152], rdi
+  mov r10, [rbp-152]
+  mov [rbp-168], r10
+  mov r10, [rbp-168]
+  mov r11, offset .L.data.195
+  mov rdi, 3
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 1
+  mov [rbp-144], rdi
+  mov rdi, 9
+  mov [rbp-80], rdi
+  mov r10, [rbp-80]
+  mov r11, offset .L.data.196
+  mov rdi, 9
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  lea r10, [rbp-8]
+  lea rdi, [rbp-72]
+  sub r10, rdi
+  mov rax, r10
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov r10, rax
+  shl r10, 3
+  mov r11, offset .L.data.197
+  mov rdi, 64
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov rdi, 2
+  mov rax, 0
+  call long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+  mov r10, rax
+  mov r11, offset .L.data.198
+  mov rdi, 20
+  mov rsi, r10
+  mov rdx, r11
+  mov rax, 0
+  call assert
+  mov r10, rax
+  mov r10, offset .L.data.199
+  mov rdi, r10
+  mov rax, 0
+  call printf
+  mov r10, rax
+  mov rax, 0
+.L.return.main:
+  mov rbx, [rbp-3152]
+  mov r12, [rbp-3160]
+  mov r13, [rbp-3168]
+  mov r14, [rbp-3176]
+  mov r15, [rbp-3184]
+  mov rsp, rbp
+  pop rbp
+  ret
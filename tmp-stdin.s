@@ -0,0 +1,3316 @@
+.intel_syntax noprefix
+.data
+.L.data.199:
+  .string "OK\012"
+.L.data.198:
+  .string "long function name"
+.L.data.197:
+  .string "&x.i - &x.a"
+.L.data.196:
+  .string "struct {int a; ... int i;} x; x.a=1; x.i=9; x.i;"
+.L.data.195:
+  .string "int x=1; int y=0; { int x=2; { int x=3; y=x; } } y;"
+.L.data.194:
+  .string "int x=1; { int x=2; { int x=3; } } x;"
+.L.data.193:
+  .string "int x[4]; x[3]=5; int *p=x+3; *(p-0);"
+.L.data.192:
+  .string "int x[4]; x[3]=5; *(x+4-1);"
+.L.data.191:
+  .string "int x=7; x*3;"
+.L.data.190:
+  .string "int x=-3; x*8;"
+.L.data.189:
+  .string "int x=7; 8*x;"
+.L.data.188:
+  .string "int x=7; x*8;"
+.L.data.187:
+  .string "int x=7; x/1;"
+.L.data.186:
+  .string "int x=7; x-0;"
+.L.data.185:
+  .string "int x=7; 0+x;"
+.L.data.184:
+  .string "int x=7; x+0;"
+.L.data.183:
+  .string "int x=7; 1*x;"
+.L.data.182:
+  .string "int x=7; x*1;"
+.L.data.181:
+  .string "1+2<3"
+.L.data.180:
+  .string "2*3==6"
+.L.data.179:
+  .string "7/2"
+.L.data.178:
+  .string "4*8"
+.L.data.177:
+  .string "struct {char a; int b;} x; sizeof(x);"
+.L.data.176:
+  .string "struct {char a; char b;} x; sizeof(x);"
+.L.data.175:
+  .string "struct {int a[3];} x[2]; sizeof(x)};"
+.L.data.174:
+  .string "struct {int a;} x[4]; sizeof(x);"
+.L.data.173:
+  .string "struct {int a[3];} x; sizeof(x);"
+.L.data.172:
+  .string "struct {int a; int b;} x; sizeof(x);"
+.L.data.171:
+  .string "struct {int a;} x; sizeof(x);"
+.L.data.170:
+  .string "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.data.169:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.data.168:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.data.167:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.data.166:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.data.165:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.data.164:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.data.163:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.data.162:
+  .string "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.data.161:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.data.160:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.data.159:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.data.158:
+  .string "int x[5]; int *y=x+2; y-x;"
+.L.data.157:
+  .string "int x[5]; int *y = x + 2; y - x;"
+.L.data.156:
+  .string "int x=2; { x=3; } x;"
+.L.data.155:
+  .string "int x=2; { int x=3; } int y=4; x;"
+.L.data.154:
+  .string "int x=2; { int x=3; } x;"
+.L.data.153:
+  .string "1100-byte string[1099]"
+.L.data.152:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.151:
+  .string "1100-byte string[1100]"
+.L.data.150:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.149:
+  .string "sizeof(1100-byte string)"
+.L.data.148:
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .ascii "WXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGH"
+  .ascii "IJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRST"
+  .ascii "UVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEF"
+  .ascii "GHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQR"
+  .ascii "STUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCD"
+  .ascii "EFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOP"
+  .ascii "QRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZAB"
+  .ascii "CDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMN"
+  .ascii "OPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  .ascii "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKL"
+  .ascii "MNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWX"
+  .ascii "YZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJ"
+  .ascii "KLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUV"
+  .string "WXYZABCDEFGH"
+.L.data.147:
+  .string "130-byte string[129]"
+.L.data.146:
+  .ascii "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl"
+  .ascii "mnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwx"
+  .string "yz"
+.L.data.145:
+  .string "sizeof(130-byte string)"
+.L.data.144:
+  .ascii "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl"
+  .ascii "mnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwx"
+  .string "yz"
+.L.data.143:
+  .string "\"\\l\"[0]"
+.L.data.142:
+  .string "l"
+.L.data.141:
+  .string "\"\\k\"[0]"
+.L.data.140:
+  .string "k"
+.L.data.139:
+  .string "\"\\j\"[0]"
+.L.data.138:
+  .string "j"
+.L.data.137:
+  .string "\"\\0\"[0]"
+.L.data.136:
+  .string "\000"
+.L.data.135:
+  .string "\"\\e\"[0]"
+.L.data.134:
+  .string "\033"
+.L.data.133:
+  .string "\"\\r\"[0]"
+.L.data.132:
+  .string "\015"
+.L.data.131:
+  .string "\"\\f\"[0]"
+.L.data.130:
+  .string "\014"
+.L.data.129:
+  .string "\"\\v\"[0]"
+.L.data.128:
+  .string "\013"
+.L.data.127:
+  .string "\"\\n\"[0]"
+.L.data.126:
+  .string "\012"
+.L.data.125:
+  .string "\"\\t\"[0]"
+.L.data.124:
+  .string "\011"
+.L.data.123:
+  .string "\"\\b\"[0]"
+.L.data.122:
+  .string "\010"
+.L.data.121:
+  .string "\"\\a\"[0]"
+.L.data.120:
+  .string "\007"
+.L.data.119:
+  .string "sizeof(\"abc\")"
+.L.data.118:
+  .string "abc"
+.L.data.117:
+  .string "\"abc\"[3]"
+.L.data.116:
+  .string "abc"
+.L.data.115:
+  .string "\"abc\"[2]"
+.L.data.114:
+  .string "abc"
+.L.data.113:
+  .string "\"abc\"[1]"
+.L.data.112:
+  .string "abc"
+.L.data.111:
+  .string "\"abc\"[0]"
+.L.data.110:
+  .string "abc"
+.L.data.109:
+  .string "sub_char(7, 3, 3)"
+.L.data.108:
+  .string "char x[10]; sizeof(x);"
+.L.data.107:
+  .string "char x; sizeof(x);"
+.L.data.106:
+  .string "char x=1; char y=2; y;"
+.L.data.105:
+  .string "char x=1; char y=2; x;"
+.L.data.104:
+  .string "char x=1; x;"
+.L.data.103:
+  .string "sizeof(g2)"
+.L.data.102:
+  .string "sizeof(g1)"
+.L.data.101:
+  .string "g2[3]"
+.L.data.100:
+  .string "g2[2]"
+.L.data.99:
+  .string "g2[1]"
+.L.data.98:
+  .string "g2[0]"
+.L.data.97:
+  .string "g1"
+.L.data.96:
+  .string "g1"
+.L.data.95:
+  .string "int x[3][4]; sizeof(**x + 1);"
+.L.data.94:
+  .string "int x[3][4]; sizeof **x + 1;"
+.L.data.93:
+  .string "int x[3][4]; sizeof(**x) + 1;"
+.L.data.92:
+  .string "int x[3][4]; sizeof(**x);"
+.L.data.91:
+  .string "int x[3][4]; sizeof(*x);"
+.L.data.90:
+  .string "int x[3][4]; sizeof(x);"
+.L.data.89:
+  .string "int x[4]; sizeof(x);"
+.L.data.88:
+  .string "int *x; sizeof(x);"
+.L.data.87:
+  .string "int x; sizeof x;"
+.L.data.86:
+  .string "int x; sizeof(x);"
+.L.data.85:
+  .string "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.data.84:
+  .string "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.data.83:
+  .string "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.data.82:
+  .string "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.data.81:
+  .string "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.data.80:
+  .string "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.data.79:
+  .string "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.data.78:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.77:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.76:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.data.75:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.data.74:
+  .string "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.data.73:
+  .string "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.data.72:
+  .string "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.data.71:
+  .string "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.data.70:
+  .string "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.data.69:
+  .string "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.data.68:
+  .string "int x[2][3]; int *y=x; *y=0; **x;"
+.L.data.67:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.data.66:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.data.65:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.data.64:
+  .string "int x[2]; int *y=&x; *y=3; *x;"
+.L.data.63:
+  .string "int x=3; int y=5; addx(&x, y);"
+.L.data.62:
+  .string "int x=3; int y=5; *(&y-1)=7; x;"
+.L.data.61:
+  .string "int x=3; int y=5; *(&x+1)=7; y;"
+.L.data.60:
+  .string "int x=3; int *y=&x; *y=5; x;"
+.L.data.59:
+  .string "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.data.58:
+  .string "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.data.57:
+  .string "int x=3; (&x+2)-&x;"
+.L.data.56:
+  .string "int x=3; int y=5; *(&y-1);"
+.L.data.55:
+  .string "int x=3; int y=5; *(&x + 1);"
+.L.data.54:
+  .string "int x=3; int y=5; *(&x+1);"
+.L.data.53:
+  .string "int x=3; int *y=&x; int **z=&y; **z;"
+.L.data.52:
+  .string "int x=3; *&x;"
+.L.data.51:
+  .string "fib(9)"
+.L.data.50:
+  .string "int x=1; add6(x, ..., add6(x, ...));"
+.L.data.49:
+  .string "int x=1; x+(x+(...(x+ret3())...));"
+.L.data.48:
+  .string "add6(1,2,3,4,5,6)"
+.L.data.47:
+  .string "sub(5, 3)"
+.L.data.46:
+  .string "add(3, 5)"
+.L.data.45:
+  .string "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.data.44:
+  .string "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.data.43:
+  .string "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.data.42:
+  .string "1; {2;} 3;"
+.L.data.41:
+  .string "int x=5; int y=0; for (; x; x=x-1) if (x>1) y=y+1; y;"
+.L.data.40:
+  .string "int x=3; int y=0; if (x!=3) y=1; else if (x==3) y=2; y;"
+.L.data.39:
+  .string "int x=0; if (2-1) x=2; else x=3; x;"
+.L.data.38:
+  .string "int x=0; if (1) x=2; else x=3; x;"
+.L.data.37:
+  .string "int x=0; if (1-1) x=2; else x=3; x;"
+.L.data.36:
+  .string "int x=0; if (0) x=2; else x=3; x;"
+.L.data.35:
+  .string "ret3();"
+.L.data.34:
+  .string "int foo123=3; int bar=5; foo123+bar;"
+.L.data.33:
+  .string "int foo=3; foo;"
+.L.data.32:
+  .string "int a=3; int z=5; a+z;"
+.L.data.31:
+  .string "int a=3; a;"
+.L.data.30:
+  .string "int a; int z; a=3; z=5; a+z;"
+.L.data.29:
+  .string "int a; a=3; a;"
+.L.data.28:
+  .string "1>=2"
+.L.data.27:
+  .string "1>=1"
+.L.data.26:
+  .string "1>=0"
+.L.data.25:
+  .string "1>2"
+.L.data.24:
+  .string "1>1"
+.L.data.23:
+  .string "1>0"
+.L.data.22:
+  .string "2<=1"
+.L.data.21:
+  .string "1<=1"
+.L.data.20:
+  .string "0<=1"
+.L.data.19:
+  .string "2<1"
+.L.data.18:
+  .string "1<1"
+.L.data.17:
+  .string "0<1"
+.L.data.16:
+  .string "42!=42"
+.L.data.15:
+  .string "0!=1"
+.L.data.14:
+  .string "42==42"
+.L.data.13:
+  .string "0==1"
+.L.data.12:
+  .string "- - +10"
+.L.data.11:
+  .string "- -10"
+.L.data.10:
+  .string "0"
+.L.data.9:
+  .string "(3+5)/2"
+.L.data.8:
+  .string "5*(9-6)"
+.L.data.7:
+  .string "0"
+.L.data.6:
+  .string " 12 + 34 - 5 "
+.L.data.5:
+  .string "0"
+.L.data.4:
+  .string "42"
+.L.data.3:
+  .string "0"
+.L.data.2:
+  .string "int a=3; int z=5; a+z;"
+.L.data.1:
+  .string "%s => %d expected but got %d\012"
+.L.data.0:
+  .string "%s => %d\012"
+g2:
+  .zero 32
+g1:
+  .zero 8
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, [rbp-24]
+  mov [rbp-32], rax
+  mov rax, [rbp-16]
+  mov [rbp-40], rax
+  mov rax, [rbp-32]
+  cmp rax, [rbp-40]
+  jne .L.assert.3
+.L.assert.2:
+  mov rax, offset .L.data.0
+  mov [rbp-32], rax
+  mov rax, [rbp-8]
+  mov [rbp-40], rax
+  mov rax, [rbp-16]
+  mov [rbp-48], rax
+  mov rdi, [rbp-32]
+  mov rsi, [rbp-40]
+  mov rdx, [rbp-48]
+  mov rax, 0
+  call printf
+  mov [rbp-32], rax
+  jmp .L.assert.4
+.L.assert.3:
+  mov rax, offset .L.data.1
+  mov [rbp-32], rax
+  mov rax, [rbp-8]
+  mov [rbp-40], rax
+  mov rax, [rbp-24]
+  mov [rbp-48], rax
+  mov rax, [rbp-16]
+  mov [rbp-56], rax
+  mov rdi, [rbp-32]
+  mov rsi, [rbp-40]
+  mov rdx, [rbp-48]
+  mov rcx, [rbp-56]
+  mov rax, 0
+  call printf
+  mov [rbp-32], rax
+  mov rdi, 1
+  mov rax, 0
+  call exit
+  mov [rbp-32], rax
+.L.assert.4:
+  mov rax, 0
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, 3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  add rax, [rbp-32]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  sub rax, [rbp-32]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-48], rdi
+  mov [rbp-40], rsi
+  mov [rbp-32], rdx
+  mov [rbp-24], rcx
+  mov [rbp-16], r8
+  mov [rbp-8], r9
+  mov rax, [rbp-48]
+  mov [rbp-56], rax
+  mov rax, [rbp-40]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-32]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-24]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-16]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-8]
+  mov [rbp-64], rax
+  mov rax, [rbp-56]
+  add rax, [rbp-64]
+  mov [rbp-56], rax
+  mov rax, [rbp-56]
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-16], rdi
+  mov [rbp-8], rsi
+  mov rax, [rbp-16]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+  mov rax, [rax]
+  mov [rbp-24], rax
+  mov rax, [rbp-8]
+  mov [rbp-32], rax
+  mov rax, [rbp-24]
+  add rax, [rbp-32]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx rax, byte ptr [rbp-3]
+  mov [rbp-16], rax
+  movsx rax, byte ptr [rbp-2]
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  sub rax, [rbp-24]
+  mov [rbp-16], rax
+  movsx rax, byte ptr [rbp-1]
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  sub rax, [rbp-24]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+  cmp rax, 1
+  jg  .L.fib.4
+.L.fib.2:
+  mov rax, 1
+  jmp .L.return.fib
+.L.fib.4:
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+  sub rax, 1
+  mov [rbp-16], rax
+  mov rdi, [rbp-16]
+  mov rax, 0
+  call fib
+  mov [rbp-16], rax
+  mov rax, [rbp-8]
+  mov [rbp-24], rax
+  mov rax, [rbp-24]
+  sub rax, 2
+  mov [rbp-24], rax
+  mov rdi, [rbp-24]
+  mov rax, 0
+  call fib
+  mov [rbp-24], rax
+  mov rax, [rbp-16]
+  add rax, [rbp-24]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rdi
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+  cmp rax, 1
+  jne .L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.4
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.2:
+  mov rax, 10
+  jmp .L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.4:
+  mov rax, [rbp-8]
+  mov [rbp-16], rax
+  mov rax, [rbp-16]
+  cmp rax, 2
+  jne .L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.7
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.5:
+  mov rax, 20
+  jmp .L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+.L.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij.7:
+  mov rax, 30
+.L.return.long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 3200
+  mov rdi, 3
+  mov [rbp-3105], rdi
+  mov rdi, 5
+  mov [rbp-3097], rdi
+  mov rax, [rbp-3105]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3097]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.2
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.3
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.4
+  mov [rbp-3120], rax
+  mov rdi, 42
+  mov rsi, 42
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.5
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.6
+  mov [rbp-3120], rax
+  mov rdi, 41
+  mov rsi, 41
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.7
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rsi, 5
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.8
+  mov [rbp-3120], rax
+  mov rdi, 15
+  mov rsi, 15
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.9
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.10
+  mov [rbp-3120], rax
+  mov rdi, -10
+  mov rsi, -10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.11
+  mov [rbp-3120], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.12
+  mov [rbp-3120], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.13
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.14
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.15
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.16
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.17
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.18
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.19
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.20
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.21
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.22
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.23
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.24
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.25
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.26
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.27
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.28
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3089], rdi
+  mov rax, [rbp-3089]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.29
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3081], rdi
+  mov rdi, 5
+  mov [rbp-3073], rdi
+  mov rax, [rbp-3081]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3073]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.30
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3065], rdi
+  mov rax, [rbp-3065]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.31
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3057], rdi
+  mov rdi, 5
+  mov [rbp-3049], rdi
+  mov rax, [rbp-3057]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3049]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.32
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3041], rdi
+  mov rax, [rbp-3041]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.33
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-3033], rdi
+  mov rdi, 5
+  mov [rbp-3025], rdi
+  mov rax, [rbp-3033]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3025]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.34
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, 0
+  call ret3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.35
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-3017], rdi
+.L.main.3:
+  mov rdi, 3
+  mov [rbp-3017], rdi
+.L.main.4:
+  mov rax, [rbp-3017]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.36
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-3009], rdi
+.L.main.6:
+  mov rdi, 3
+  mov [rbp-3009], rdi
+.L.main.7:
+  mov rax, [rbp-3009]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.37
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-3001], rdi
+.L.main.8:
+  mov rdi, 2
+  mov [rbp-3001], rdi
+.L.main.10:
+  mov rax, [rbp-3001]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.38
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2993], rdi
+.L.main.11:
+  mov rdi, 2
+  mov [rbp-2993], rdi
+.L.main.13:
+  mov rax, [rbp-2993]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.39
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2985], rdi
+  mov rdi, 0
+  mov [rbp-2977], rdi
+  mov rax, [rbp-2985]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 3
+  je  .L.main.15
+.L.main.14:
+  mov rdi, 1
+  mov [rbp-2977], rdi
+  jmp .L.main.18
+.L.main.15:
+  mov rax, [rbp-2985]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 3
+  jne .L.main.17
+.L.main.16:
+  mov rdi, 2
+  mov [rbp-2977], rdi
+.L.main.17:
+.L.main.18:
+  mov rax, [rbp-2977]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.40
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov [rbp-2969], rdi
+  mov rdi, 0
+  mov [rbp-2961], rdi
+.L.main.19:
+  mov rax, [rbp-2969]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 0
+  je  .L.main.23
+.L.main.20:
+  mov rax, [rbp-2969]
+  mov [rbp-3120], rax
+  mov rax, 1
+  cmp rax, [rbp-3120]
+  jge .L.main.22
+.L.main.21:
+  mov rax, [rbp-2961]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2961], rdi
+.L.main.22:
+  mov rax, [rbp-2969]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  sub rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2969], rdi
+  jmp .L.main.19
+.L.main.23:
+  mov rax, [rbp-2961]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.41
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.42
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2953], rdi
+  mov rdi, 0
+  mov [rbp-2953], rdi
+.L.main.24:
+  mov rax, [rbp-2953]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 10
+  jge .L.main.26
+.L.main.25:
+  mov rax, [rbp-2953]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2953], rdi
+  jmp .L.main.24
+.L.main.26:
+  mov rax, [rbp-2953]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.43
+  mov [rbp-3128], rax
+  mov rdi, 10
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2945], rdi
+  mov rdi, 0
+  mov [rbp-2937], rdi
+.L.main.27:
+  mov rax, [rbp-2945]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 10
+  jg  .L.main.29
+.L.main.28:
+  mov rax, [rbp-2945]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2937]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2937], rdi
+  mov rax, [rbp-2945]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2945], rdi
+  jmp .L.main.27
+.L.main.29:
+  mov rax, [rbp-2937]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.44
+  mov [rbp-3128], rax
+  mov rdi, 55
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov [rbp-2929], rdi
+  mov rdi, 0
+  mov [rbp-2921], rdi
+  mov rdi, 0
+  mov [rbp-2929], rdi
+.L.main.30:
+  mov rax, [rbp-2929]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cmp rax, 10
+  jg  .L.main.32
+.L.main.31:
+  mov rax, [rbp-2929]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2921]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2921], rdi
+  mov rax, [rbp-2929]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-2929], rdi
+  jmp .L.main.30
+.L.main.32:
+  mov rax, [rbp-2921]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.45
+  mov [rbp-3128], rax
+  mov rdi, 55
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rsi, 5
+  mov rax, 0
+  call add2
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.46
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rsi, 3
+  mov rax, 0
+  call sub2
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.47
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 2
+  mov rdx, 3
+  mov rcx, 4
+  mov r8, 5
+  mov r9, 6
+  mov rax, 0
+  call add6
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.48
+  mov [rbp-3128], rax
+  mov rdi, 21
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-2913], rdi
+  mov rax, [rbp-2913]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3128], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3136], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3144], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3152], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3160], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3168], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3176], rax
+  mov rax, [rbp-2913]
+  mov [rbp-3184], rax
+  mov rax, 0
+  call ret3
+  mov [rbp-3192], rax
+  mov rax, [rbp-3184]
+  add rax, [rbp-3192]
+  mov [rbp-3184], rax
+  mov rax, [rbp-3176]
+  add rax, [rbp-3184]
+  mov [rbp-3176], rax
+  mov rax, [rbp-3168]
+  add rax, [rbp-3176]
+  mov [rbp-3168], rax
+  mov rax, [rbp-3160]
+  add rax, [rbp-3168]
+  mov [rbp-3160], rax
+  mov rax, [rbp-3152]
+  add rax, [rbp-3160]
+  mov [rbp-3152], rax
+  mov rax, [rbp-3144]
+  add rax, [rbp-3152]
+  mov [rbp-3144], rax
+  mov rax, [rbp-3136]
+  add rax, [rbp-3144]
+  mov [rbp-3136], rax
+  mov rax, [rbp-3128]
+  add rax, [rbp-3136]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3120]
+  add rax, [rbp-3128]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.49
+  mov [rbp-3128], rax
+  mov rdi, 12
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-2905], rdi
+  mov rax, [rbp-2905]
+  mov [rbp-3120], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3128], rax
+  mov rax, [rbp-3128]
+  add rax, 1
+  mov [rbp-3128], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3136], rax
+  mov rax, [rbp-3136]
+  add rax, 2
+  mov [rbp-3136], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3144], rax
+  mov rax, [rbp-3144]
+  add rax, 3
+  mov [rbp-3144], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3152], rax
+  mov rax, [rbp-3152]
+  add rax, 4
+  mov [rbp-3152], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3160], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3168], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3176], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3184], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3192], rax
+  mov rax, [rbp-2905]
+  mov [rbp-3200], rax
+  mov rdi, [rbp-3160]
+  mov rsi, [rbp-3168]
+  mov rdx, [rbp-3176]
+  mov rcx, [rbp-3184]
+  mov r8, [rbp-3192]
+  mov r9, [rbp-3200]
+  mov rax, 0
+  call add6
+  mov [rbp-3160], rax
+  mov rdi, [rbp-3120]
+  mov rsi, [rbp-3128]
+  mov rdx, [rbp-3136]
+  mov rcx, [rbp-3144]
+  mov r8, [rbp-3152]
+  mov r9, [rbp-3160]
+  mov rax, 0
+  call add6
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.50
+  mov [rbp-3128], rax
+  mov rdi, 21
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rax, 0
+  call fib
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.51
+  mov [rbp-3128], rax
+  mov rdi, 55
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2897], rdi
+  mov rax, [rbp-2897]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.52
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2889], rdi
+  lea rdi, [rbp-2889]
+  mov [rbp-2881], rdi
+  lea rdi, [rbp-2881]
+  mov [rbp-2873], rdi
+  mov rax, [rbp-2873]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.53
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2865], rdi
+  mov rdi, 5
+  mov [rbp-2857], rdi
+  mov rax, [rbp-2857]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.54
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2849], rdi
+  mov rdi, 5
+  mov [rbp-2841], rdi
+  mov rax, [rbp-2841]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.55
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2833], rdi
+  mov rdi, 5
+  mov [rbp-2825], rdi
+  mov rax, [rbp-2833]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.56
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2817], rdi
+  lea rax, [rbp-2801]
+  lea rdi, [rbp-2817]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.57
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2809], rdi
+  mov rdi, 5
+  mov [rbp-2801], rdi
+  lea rdi, [rbp-2809]
+  mov [rbp-2793], rdi
+  mov rax, [rbp-2793]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.58
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2785], rdi
+  mov rdi, 5
+  mov [rbp-2777], rdi
+  lea rdi, [rbp-2777]
+  mov [rbp-2769], rdi
+  mov rax, [rbp-2769]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  sub rax, 8
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.59
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2761], rdi
+  lea rdi, [rbp-2761]
+  mov [rbp-2753], rdi
+  mov rax, [rbp-2753]
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2761]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.60
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2745], rdi
+  mov rdi, 5
+  mov [rbp-2737], rdi
+  mov rdi, 7
+  mov [rbp-2737], rdi
+  mov rax, [rbp-2737]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.61
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2729], rdi
+  mov rdi, 5
+  mov [rbp-2721], rdi
+  mov rdi, 7
+  mov [rbp-2729], rdi
+  mov rax, [rbp-2729]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.62
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2713], rdi
+  mov rdi, 5
+  mov [rbp-2705], rdi
+  mov rax, [rbp-2705]
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2713]
+  mov rsi, [rbp-3120]
+  mov rax, 0
+  call addx
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.63
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2697]
+  mov [rbp-2681], rdi
+  mov rax, [rbp-2681]
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2697]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.64
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2673], rdi
+  mov rdi, 4
+  mov [rbp-2665], rdi
+  mov rdi, 5
+  mov [rbp-2657], rdi
+  mov rax, [rbp-2673]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.65
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2649], rdi
+  mov rdi, 4
+  mov [rbp-2641], rdi
+  mov rdi, 5
+  mov [rbp-2633], rdi
+  mov rax, [rbp-2641]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.66
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2625], rdi
+  mov rdi, 4
+  mov [rbp-2617], rdi
+  mov rdi, 5
+  mov [rbp-2609], rdi
+  mov rax, [rbp-2609]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.67
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2601]
+  mov [rbp-2553], rdi
+  mov rax, [rbp-2553]
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2601]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.68
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2545]
+  mov [rbp-2497], rdi
+  mov rax, [rbp-2497]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2537]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.69
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2489]
+  mov [rbp-2441], rdi
+  mov rax, [rbp-2441]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2473]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.70
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2433]
+  mov [rbp-2385], rdi
+  mov rax, [rbp-2385]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2409]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.71
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2377]
+  mov [rbp-2329], rdi
+  mov rax, [rbp-2329]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 32
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2345]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.72
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2321]
+  mov [rbp-2273], rdi
+  mov rax, [rbp-2273]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 40
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2281]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.73
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2265]
+  mov [rbp-2217], rdi
+  mov rax, [rbp-2217]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 48
+  mov [rbp-3120], rax
+  mov rdi, 6
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2217]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.74
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2209], rdi
+  mov rdi, 4
+  mov [rbp-2201], rdi
+  mov rdi, 5
+  mov [rbp-2193], rdi
+  mov rax, [rbp-2209]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.75
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2185], rdi
+  mov rdi, 4
+  mov [rbp-2177], rdi
+  mov rdi, 5
+  mov [rbp-2169], rdi
+  mov rax, [rbp-2177]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.76
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2161], rdi
+  mov rdi, 4
+  mov [rbp-2153], rdi
+  mov rdi, 5
+  mov [rbp-2145], rdi
+  mov rax, [rbp-2145]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.77
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov [rbp-2137], rdi
+  mov rdi, 4
+  mov [rbp-2129], rdi
+  mov rdi, 5
+  mov [rbp-2121], rdi
+  mov rax, [rbp-2121]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.78
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2113]
+  mov [rbp-2065], rdi
+  mov rax, [rbp-2065]
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2113]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.79
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2057]
+  mov [rbp-2009], rdi
+  mov rax, [rbp-2009]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-2049]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.80
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-2001]
+  mov [rbp-1953], rdi
+  mov rax, [rbp-1953]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1985]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.81
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1945]
+  mov [rbp-1897], rdi
+  mov rax, [rbp-1897]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1921]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.82
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1889]
+  mov [rbp-1841], rdi
+  mov rax, [rbp-1841]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 32
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1857]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.83
+  mov [rbp-3128], rax
+  mov rdi, 4
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1833]
+  mov [rbp-1785], rdi
+  mov rax, [rbp-1785]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 40
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1793]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.84
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1777]
+  mov [rbp-1729], rdi
+  mov rax, [rbp-1729]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 48
+  mov [rbp-3120], rax
+  mov rdi, 6
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-1729]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.85
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.86
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.87
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.88
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.89
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.90
+  mov [rbp-3120], rax
+  mov rdi, 96
+  mov rsi, 96
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.91
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.92
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.93
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.94
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.95
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g1
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.96
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g1
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g1
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.97
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.98
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.99
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.100
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset g2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.101
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.102
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.103
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-1089], dil
+  movsx rax, byte ptr [rbp-1089]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.104
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-1088], dil
+  mov rdi, 2
+  mov [rbp-1087], dil
+  movsx rax, byte ptr [rbp-1088]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.105
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-1086], dil
+  mov rdi, 2
+  mov [rbp-1085], dil
+  movsx rax, byte ptr [rbp-1085]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.106
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.107
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.108
+  mov [rbp-3120], rax
+  mov rdi, 10
+  mov rsi, 10
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov rsi, 3
+  mov rdx, 3
+  mov rax, 0
+  call sub_char
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.109
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.110
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.111
+  mov [rbp-3128], rax
+  mov rdi, 97
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.112
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.113
+  mov [rbp-3128], rax
+  mov rdi, 98
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.114
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 2
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.115
+  mov [rbp-3128], rax
+  mov rdi, 99
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.116
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 3
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.117
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.119
+  mov [rbp-3120], rax
+  mov rdi, 4
+  mov rsi, 4
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.120
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.121
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.122
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.123
+  mov [rbp-3128], rax
+  mov rdi, 8
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.124
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.125
+  mov [rbp-3128], rax
+  mov rdi, 9
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.126
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.127
+  mov [rbp-3128], rax
+  mov rdi, 10
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.128
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.129
+  mov [rbp-3128], rax
+  mov rdi, 11
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.130
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.131
+  mov [rbp-3128], rax
+  mov rdi, 12
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.132
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.133
+  mov [rbp-3128], rax
+  mov rdi, 13
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.134
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.135
+  mov [rbp-3128], rax
+  mov rdi, 27
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.136
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.137
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.138
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.139
+  mov [rbp-3128], rax
+  mov rdi, 106
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.140
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.141
+  mov [rbp-3128], rax
+  mov rdi, 107
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.142
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.143
+  mov [rbp-3128], rax
+  mov rdi, 108
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.145
+  mov [rbp-3120], rax
+  mov rdi, 131
+  mov rsi, 131
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.146
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 129
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.147
+  mov [rbp-3128], rax
+  mov rdi, 122
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.149
+  mov [rbp-3120], rax
+  mov rdi, 1101
+  mov rsi, 1101
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.150
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1100
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.151
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.152
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 1099
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  movsx rax, byte ptr [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.153
+  mov [rbp-3128], rax
+  mov rdi, 72
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov [rbp-1073], rdi
+  mov rdi, 3
+  mov [rbp-1065], rdi
+  mov rax, [rbp-1073]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.154
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov [rbp-1057], rdi
+  mov rdi, 3
+  mov [rbp-1049], rdi
+  mov rdi, 4
+  mov [rbp-1041], rdi
+  mov rax, [rbp-1057]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.155
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov [rbp-1033], rdi
+  mov rdi, 3
+  mov [rbp-1033], rdi
+  mov rax, [rbp-1033]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.156
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-1009]
+  mov [rbp-985], rdi
+  mov rax, [rbp-985]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  lea rdi, [rbp-1025]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.157
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-961]
+  mov [rbp-937], rdi
+  mov rax, [rbp-937]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  lea rdi, [rbp-977]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.158
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-929], rdi
+  mov rdi, 2
+  mov [rbp-921], rdi
+  mov rax, [rbp-929]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.159
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-913], rdi
+  mov rdi, 2
+  mov [rbp-905], rdi
+  mov rax, [rbp-905]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.160
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-897], dil
+  mov rdi, 2
+  mov [rbp-896], rdi
+  mov rdi, 3
+  mov [rbp-888], dil
+  movsx rax, byte ptr [rbp-897]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.161
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-886], rdi
+  mov rdi, 2
+  mov [rbp-886], rdi
+  mov rdi, 3
+  mov [rbp-878], dil
+  mov rax, [rbp-886]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.162
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-877], dil
+  mov rdi, 2
+  mov [rbp-876], rdi
+  mov rdi, 3
+  mov [rbp-868], dil
+  movsx rax, byte ptr [rbp-868]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.163
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-867]
+  mov [rbp-819], rdi
+  mov rax, [rbp-819]
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-867]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.164
+  mov [rbp-3128], rax
+  mov rdi, 0
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-811]
+  mov [rbp-763], rdi
+  mov rax, [rbp-763]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 8
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-803]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.165
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-755]
+  mov [rbp-707], rdi
+  mov rax, [rbp-707]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 16
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-739]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.166
+  mov [rbp-3128], rax
+  mov rdi, 2
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-699]
+  mov [rbp-651], rdi
+  mov rax, [rbp-651]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rax, [rbp-3120]
+  mov [rax], rdi
+  mov rax, [rbp-675]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.167
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-643]
+  mov [rbp-579], rdi
+  mov rdi, 6
+  mov [rbp-643], rdi
+  mov rax, [rbp-579]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.168
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rdi, [rbp-571]
+  mov [rbp-507], rdi
+  mov rdi, 7
+  mov [rbp-547], rdi
+  mov rax, [rbp-507]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  add rax, 24
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.169
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 6
+  mov [rbp-499], rdi
+  mov rax, [rbp-499]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.170
+  mov [rbp-3128], rax
+  mov rdi, 6
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.171
+  mov [rbp-3120], rax
+  mov rdi, 8
+  mov rsi, 8
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.172
+  mov [rbp-3120], rax
+  mov rdi, 16
+  mov rsi, 16
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.173
+  mov [rbp-3120], rax
+  mov rdi, 24
+  mov rsi, 24
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.174
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.175
+  mov [rbp-3120], rax
+  mov rdi, 48
+  mov rsi, 48
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.176
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rsi, 2
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.177
+  mov [rbp-3120], rax
+  mov rdi, 9
+  mov rsi, 9
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.178
+  mov [rbp-3120], rax
+  mov rdi, 32
+  mov rsi, 32
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.179
+  mov [rbp-3120], rax
+  mov rdi, 3
+  mov rsi, 3
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.180
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov rsi, 1
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.181
+  mov [rbp-3120], rax
+  mov rdi, 0
+  mov rsi, 0
+  mov rdx, [rbp-3120]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-352], rdi
+  mov rax, [rbp-352]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.182
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-344], rdi
+  mov rax, [rbp-344]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.183
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-336], rdi
+  mov rax, [rbp-336]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.184
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-328], rdi
+  mov rax, [rbp-328]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.185
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-320], rdi
+  mov rax, [rbp-320]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.186
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-312], rdi
+  mov rax, [rbp-312]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.187
+  mov [rbp-3128], rax
+  mov rdi, 7
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-304], rdi
+  mov rax, [rbp-304]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.188
+  mov [rbp-3128], rax
+  mov rdi, 56
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-296], rdi
+  mov rax, [rbp-296]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.189
+  mov [rbp-3128], rax
+  mov rdi, 56
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, -3
+  mov [rbp-288], rdi
+  mov rax, [rbp-288]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.190
+  mov [rbp-3128], rax
+  mov rdi, -24
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 7
+  mov [rbp-280], rdi
+  mov rax, [rbp-280]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  imul rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.191
+  mov [rbp-3128], rax
+  mov rdi, 21
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov [rbp-248], rdi
+  mov rax, [rbp-248]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.192
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 5
+  mov [rbp-216], rdi
+  lea rdi, [rbp-216]
+  mov [rbp-208], rdi
+  mov rax, [rbp-208]
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  mov rax, [rax]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.193
+  mov [rbp-3128], rax
+  mov rdi, 5
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-200], rdi
+  mov rdi, 2
+  mov [rbp-192], rdi
+  mov rdi, 3
+  mov [rbp-184], rdi
+  mov rax, [rbp-200]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.194
+  mov [rbp-3128], rax
+  mov rdi, 1
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-176], rdi
+  mov rdi, 0
+  mov [rbp-168], rdi
+  mov rdi, 2
+  mov [rbp-160], rdi
+  mov rdi, 3
+  mov [rbp-152], rdi
+  mov rax, [rbp-152]
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov [rbp-168], rdi
+  mov rax, [rbp-168]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.195
+  mov [rbp-3128], rax
+  mov rdi, 3
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 1
+  mov [rbp-144], rdi
+  mov rdi, 9
+  mov [rbp-80], rdi
+  mov rax, [rbp-80]
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.196
+  mov [rbp-3128], rax
+  mov rdi, 9
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  lea rax, [rbp-8]
+  lea rdi, [rbp-72]
+  sub rax, rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  cqo
+  mov rdi, 8
+  idiv rdi
+  mov [rbp-3120], rax
+  mov rax, [rbp-3120]
+  shl rax, 3
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.197
+  mov [rbp-3128], rax
+  mov rdi, 64
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rdi, 2
+  mov rax, 0
+  call long_name_abcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghijabcdefghij
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.198
+  mov [rbp-3128], rax
+  mov rdi, 20
+  mov rsi, [rbp-3120]
+  mov rdx, [rbp-3128]
+  mov rax, 0
+  call assert
+  mov [rbp-3120], rax
+  mov rax, offset .L.data.199
+  mov [rbp-3120], rax
+  mov rdi, [rbp-3120]
+  mov rax, 0
+  call printf
+  mov [rbp-3120], rax
+  mov rax, 0
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
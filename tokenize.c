@@ -1,12 +1,38 @@
 #include "9cc.h"
-
-char *filename;
-char *user_input;
-Token *token;
+#include <pthread.h>
+#include <setjmp.h>
+
+// 並列に字句解析している間は，エラーを報告せずにここへ戻る
+static _Thread_local jmp_buf *lex_bailout;
+
+// compile() の中ならエラーを記録して呼び出し元に戻る
+static void bailout(Diagnostic *diag, char *fmt, va_list ap) {
+    // 並列字句解析のワーカーは compile() を呼んだスレッドの jmp_buf には
+    // 戻れないので，チャンクを失敗にするだけ．エラーは呼び出し元のスレッド
+    // でそのチャンクを読み直した時に報告される
+    if (lex_bailout)
+        longjmp(*lex_bailout, 1);
+
+    CompileContext *c = ctx;
+    if (!c || !c->bailout)
+        return;
+
+    va_list ap2;
+    va_copy(ap2, ap);
+    int len = vsnprintf(NULL, 0, fmt, ap2);
+    va_end(ap2);
+    diag->message = malloc(len + 1);
+    vsnprintf(diag->message, len + 1, fmt, ap);
+
+    c->diags = realloc(c->diags, (c->ndiags + 1) * sizeof(Diagnostic));
+    c->diags[c->ndiags++] = *diag;
+    longjmp(*c->bailout, 1);
+}
 
 void error(char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
+    bailout(&(Diagnostic){ctx ? ctx->filename : NULL}, fmt, ap);
     vfprintf(stderr, fmt, ap);
     fprintf(stderr, "\n");
     exit(1);
@@ -17,6 +43,11 @@ void error(char *fmt, ...) {
 // foo.c:10: x = y + 1;
 //               ^ <error message here>
 static void verror_at(char *loc, char *fmt, va_list ap) {
+    if (lex_bailout)
+        longjmp(*lex_bailout, 1);
+
+    char *user_input = ctx->user_input;
+
     // Find a line containing `loc`
     char *line = loc;
     while (user_input < line && line[-1] != '\n')
@@ -32,8 +63,10 @@ static void verror_at(char *loc, char *fmt, va_list ap) {
         if (*p == '\n')
             line_num++;
 
+    bailout(&(Diagnostic){ctx->filename, line_num, loc - line + 1}, fmt, ap);
+
     // Print out the line
-    int indent = fprintf(stderr, "%s:%d: ", filename, line_num);
+    int indent = fprintf(stderr, "%s:%d: ", ctx->filename, line_num);
     fprintf(stderr, "%.*s\n", (int)(end - line), line);
 
     // Show the error message;
@@ -53,115 +86,249 @@ void error_at(char *loc, char *fmt, ...) {
 }
 
 // エラー箇所を報告する
-void error_tok(Token *tok, char *fmt, ...) {
+void error_tok(Token tok, char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
-    verror_at(tok->str, fmt, ap);
+    verror_at(tok_str(tok), fmt, ap);
+}
+
+// Returns the position of the token in the source.
+char *tok_str(Token tok) {
+    return ctx->user_input + ctx->tokens.loc[tok];
+}
+
+// Returns the interned spelling of an identifier or a punctuator.
+char *tok_atom(Token tok) {
+    return ctx->atoms[ctx->tokens.val[tok]];
+}
+
+// Returns the contents of a string literal, including the terminating
+// '\0'. The length is given by tok_cont_len().
+char *tok_contents(Token tok) {
+    TokenArray *ts = &ctx->tokens;
+    return ts->strbuf + ts->strs[ts->val[tok]].offset;
+}
+
+int tok_cont_len(Token tok) {
+    TokenArray *ts = &ctx->tokens;
+    return ts->strs[ts->val[tok]].len;
 }
 
 
+static int atom_of(char *op);
+
 // 次のトークンが期待している記号の時は，トークンを1つ読み進めて
-// 真を返す．それ以外の場合には偽を返す
-Token *consume(char *op) {
-    if (token->kind != TK_RESERVED || strlen(op) != token->len ||
-            strncmp(token->str, op, token->len))
-        return NULL;
-    Token *t = token;
-    token = token->next;
-    return t;
-}
-
-// 現在のトークンが与えられた文字列とマッチしたらtrueを返す
-Token *peek(char *s) {
-    if (token->kind != TK_RESERVED || strlen(s) != token->len ||
-            strncmp(token->str, s, token->len)) {
-        return NULL;
-    }
-    return token;
+// そのトークンを返す．それ以外の場合には0を返す
+Token consume(char *op) {
+    CompileContext *c = ctx;
+    if (c->tokens.kind[c->token] != TK_RESERVED || c->tokens.val[c->token] != atom_of(op))
+        return 0;
+    return c->token++;
 }
 
-Token *consume_ident() {
-    if (token->kind != TK_IDENT) {
-        return NULL;
-    }
-    Token *t = token;
-    token = token->next;
-    return t;
+// 現在のトークンが与えられた文字列とマッチしたらそのトークンを返す
+Token peek(char *s) {
+    CompileContext *c = ctx;
+    if (c->tokens.kind[c->token] != TK_RESERVED || c->tokens.val[c->token] != atom_of(s))
+        return 0;
+    return c->token;
+}
+
+Token consume_ident() {
+    CompileContext *c = ctx;
+    if (c->tokens.kind[c->token] != TK_IDENT)
+        return 0;
+    return c->token++;
 }
 
 // 次のトークンが期待している記号の時は，トークンを1つ読み進める．
 // それ以外の場合にはエラーを報告する
 void expect(char *s) {
     if (!peek(s))
-        error_tok(token, "expected \"%s\"", s);
-    token = token->next;
+        error_tok(ctx->token, "expected \"%s\"", s);
+    ctx->token++;
 }
 
 // 次のトークンが数値の場合，トークンを1つ読み進めてその数値を返す．
 // それ以外の場合にはエラーを報告する．
 long expect_number() {
-    if (token->kind != TK_NUM)
-        error_tok(token, "数値ではありません．");
-    long val = token->val;
-    token = token->next;
-    return val;
+    CompileContext *c = ctx;
+    if (c->tokens.kind[c->token] != TK_NUM)
+        error_tok(c->token, "数値ではありません．");
+    return c->tokens.val[c->token++];
 }
 
-// 次のトークンがIdentifierの場合，トークンを1つ読み進めてその数値を返す
-// それ以外の場合にはエラーを報告する
+// 次のトークンがIdentifierの場合，トークンを1つ読み進めてその名前を
+// 返す．それ以外の場合にはエラーを報告する
 char *expect_ident() {
-    if (token->kind != TK_IDENT)
-        error_tok(token, "expected an identifier");
-    char *s = strndup(token->str, token->len);
-    token = token->next;
-    return s;
+    CompileContext *c = ctx;
+    if (c->tokens.kind[c->token] != TK_IDENT)
+        error_tok(c->token, "expected an identifier");
+    return tok_atom(c->token++);
 }
 
 bool at_eof() {
-    return token->kind == TK_EOF;
+    return ctx->tokens.kind[ctx->token] == TK_EOF;
 }
 
-// 新しいトークンを作成してcurに繋げる
-Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-    Token *tok = calloc(1, sizeof(Token));
-    tok->kind = kind;
-    tok->str = str;
-    tok->len = len;
-    cur->next = tok;
-    return tok;
+// 新しいトークンを ts の末尾に足す
+static void add_token(TokenArray *ts, TokenKind kind, char *str, long len, int val) {
+    if (ts->size == ts->capacity) {
+        ts->capacity = ts->capacity ? ts->capacity * 2 : 1024;
+        ts->kind = realloc(ts->kind, ts->capacity);
+        ts->loc = realloc(ts->loc, ts->capacity * sizeof(uint32_t));
+        ts->len = realloc(ts->len, ts->capacity * sizeof(uint32_t));
+        ts->val = realloc(ts->val, ts->capacity * sizeof(int));
+        if (!ts->kind || !ts->loc || !ts->len || !ts->val)
+            error("out of memory");
+    }
+
+    int i = ts->size++;
+    ts->kind[i] = kind;
+    ts->loc[i] = str - ctx->user_input;
+    ts->len[i] = len;
+    ts->val[i] = val;
 }
 
 static bool startswith(char *p, char *q) {
     return strncmp(p, q, strlen(q)) == 0;
 }
 
-static bool is_alpha(char c) {
-    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+// 文字クラス．1文字読むごとに表を1回引くだけで分類できる
+enum {
+    C_SPACE = 1,  // 空白文字
+    C_ALPHA = 2,  // 識別子の先頭になれる文字
+    C_DIGIT = 4,  // 数字
+    C_PUNCT = 8,  // 記号
+    C_MULTI = 16, // 2文字以上の記号の先頭になりうる文字
+};
+
+static unsigned char char_class[256];
+
+// 2文字以上の記号．同じ文字で始まるものは長い順に並べておくと，
+// 先に見つかったものが最長一致になる
+static struct {
+    char *op;
+    int len;
+    int id;
+} multi_ops[] = {
+    {"==", 2}, {"!=", 2}, {"<=", 2}, {">=", 2},
+};
+
+// 1文字の記号の atom の番号
+static int punct_id[256];
+
+// キーワードの完全ハッシュ表．ハッシュ値は先頭と末尾の文字と長さだけから
+// 計算できるので，識別子を読み終えた時点で表を1回引けば判定できる．
+// キーワードを足して衝突したら KW_HASH を変えること
+#define KW_HASH(first, last, len) (((first) + (last) + (len)) & 31)
+#define KW(s, first, last) [KW_HASH(first, last, sizeof(s) - 1)] = {s, sizeof(s) - 1}
+
+static struct {
+    char *name;
+    int len;
+    int id;
+} kw_table[32] = {
+    KW("return", 'r', 'n'), KW("if", 'i', 'f'), KW("else", 'e', 'e'),
+    KW("while", 'w', 'e'), KW("for", 'f', 'r'), KW("int", 'i', 't'),
+    KW("char", 'c', 'r'), KW("sizeof", 's', 'f'), KW("struct", 's', 't'),
+};
+
+// 記号とキーワードの atom の番号は，どのコンテキストでもここで決めた
+// 番号になるように intern_fixed_atoms() が最初に登録する
+static void init_tables() {
+    int id = 0;
+
+    for (int c = 1; c < 256; c++) {
+        if (isspace(c))
+            char_class[c] |= C_SPACE;
+        else if (isalpha(c) || c == '_')
+            char_class[c] |= C_ALPHA;
+        else if (isdigit(c))
+            char_class[c] |= C_DIGIT;
+        else if (ispunct(c))
+            char_class[c] |= C_PUNCT;
+    }
+
+    for (int i = 0; i < sizeof(multi_ops) / sizeof(*multi_ops); i++) {
+        char_class[(unsigned char)multi_ops[i].op[0]] |= C_MULTI;
+        multi_ops[i].id = id++;
+    }
+
+    for (int i = 0; i < sizeof(kw_table) / sizeof(*kw_table); i++)
+        if (kw_table[i].name)
+            kw_table[i].id = id++;
+
+    for (int c = 1; c < 256; c++)
+        if (char_class[c] & C_PUNCT)
+            punct_id[c] = id++;
 }
 
-static bool is_alnum(char c) {
-    return is_alpha(c) || ('0' <= c && c <= '9');
+// intern() は複数のスレッドから呼べないので，記号の atom は字句解析の
+// 前に作っておく
+static void intern_fixed_atoms() {
+    for (int i = 0; i < sizeof(multi_ops) / sizeof(*multi_ops); i++)
+        if (intern_id(multi_ops[i].op, multi_ops[i].len) != multi_ops[i].id)
+            unreachable();
+
+    for (int i = 0; i < sizeof(kw_table) / sizeof(*kw_table); i++)
+        if (kw_table[i].name && intern_id(kw_table[i].name, kw_table[i].len) != kw_table[i].id)
+            unreachable();
+
+    for (int c = 1; c < 256; c++) {
+        char s = c;
+        if ((char_class[c] & C_PUNCT) && intern_id(&s, 1) != punct_id[c])
+            unreachable();
+    }
 }
 
-static char *starts_with_reserved(char *p) {
-    // Keyword
-    static char *kw[] = {"return", "if", "else", "while", "for", "int",
-                         "char", "sizeof", "struct"};
+// Returns the keyword's atom number if p[0..len) is a keyword, or -1.
+static int find_keyword(char *p, int len) {
+    int h = KW_HASH(p[0], p[len - 1], len);
+    if (kw_table[h].len == len && !memcmp(kw_table[h].name, p, len))
+        return kw_table[h].id;
+    return -1;
+}
 
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
-        int len = strlen(kw[i]);
-        if (startswith(p, kw[i]) && !is_alnum(p[len]))
-            return kw[i];
+// Returns the atom number of op, which must be a punctuator or a
+// keyword. The number is looked up by contents in the same fixed tables
+// the lexer uses, so it costs a table lookup or a few byte comparisons
+// and no hashing.
+static int atom_of(char *op) {
+    if (!op[1]) {
+        unsigned char c = *op;
+        if (!(char_class[c] & C_PUNCT))
+            unreachable();
+        return punct_id[c];
     }
 
-    // Multi-letter-punctuator
-    static char *ops[] = {"==", "!=", "<=", ">="};
-    for (int i = 0; i < sizeof(ops) / sizeof(*ops); i++) {
-        if (startswith(p, ops[i])) {
-            return ops[i];
+    int len = strlen(op);
+    if (len == 2)
+        for (int i = 0; i < sizeof(multi_ops) / sizeof(*multi_ops); i++)
+            if (multi_ops[i].op[0] == op[0] && multi_ops[i].op[1] == op[1])
+                return multi_ops[i].id;
+
+    int id = find_keyword(op, len);
+    if (id < 0)
+        unreachable();
+    return id;
+}
+
+// Adds a token for the longest punctuator at p and returns its length.
+static int read_punct(TokenArray *ts, char *p) {
+    unsigned char c = *p;
+
+    if (char_class[c] & C_MULTI) {
+        for (int i = 0; i < sizeof(multi_ops) / sizeof(*multi_ops); i++) {
+            if (multi_ops[i].op[0] == c && !strncmp(p, multi_ops[i].op, multi_ops[i].len)) {
+                add_token(ts, TK_RESERVED, p, multi_ops[i].len, multi_ops[i].id);
+                return multi_ops[i].len;
+            }
         }
     }
-    return NULL;
+
+    add_token(ts, TK_RESERVED, p, 1, punct_id[c]);
+    return 1;
 }
 
 static char get_escape_char(char c) {
@@ -179,111 +346,368 @@ static char get_escape_char(char c) {
     }
 }
 
-static Token *read_string_literal(Token *cur, char *start) {
+// Makes room for at least n more bytes in the side buffer of ts.
+static void reserve_strbuf(TokenArray *ts, long n) {
+    if (ts->strbuf_len + n <= ts->strbuf_capacity)
+        return;
+
+    long cap = ts->strbuf_capacity ? ts->strbuf_capacity : 4096;
+    while (ts->strbuf_len + n > cap)
+        cap *= 2;
+    if (cap > INT_MAX)
+        error("string literals too large");
+
+    ts->strbuf = realloc(ts->strbuf, cap);
+    if (!ts->strbuf)
+        error("out of memory");
+    ts->strbuf_capacity = cap;
+}
+
+// Registers strbuf[offset, offset + len) as a string literal and
+// returns its number.
+static int add_strlit(TokenArray *ts, int offset, int len) {
+    if (ts->nstrs == ts->strs_capacity) {
+        ts->strs_capacity = ts->strs_capacity ? ts->strs_capacity * 2 : 64;
+        ts->strs = realloc(ts->strs, ts->strs_capacity * sizeof(StrLit));
+        if (!ts->strs)
+            error("out of memory");
+    }
+    ts->strs[ts->nstrs] = (StrLit){offset, len};
+    return ts->nstrs++;
+}
+
+// Adds a string literal token and returns its length in the source.
+// The contents are unescaped straight into the side buffer, copying
+// each run without escapes at once, so there is no size limit.
+static int read_string_literal(TokenArray *ts, char *start) {
     char *p = start + 1;
-    char buf[1024];
-    int len = 0;
+    int offset = ts->strbuf_len;
 
     for (;;) {
-        if (len == sizeof(buf))
-            error_at(start, "string literal too large");
+        char *q = find_byte2(p, '"', '\\');
+
+        // エスケープされた1文字と終端の '\0' の分も確保しておく
+        reserve_strbuf(ts, q - p + 2);
+        memcpy(ts->strbuf + ts->strbuf_len, p, q - p);
+        ts->strbuf_len += q - p;
+        p = q;
+
         if (*p == '\0')
             error_at(start, "unclosed string literal");
         if (*p == '"')
             break;
 
-        if (*p == '\\') {
-            p++;
-            buf[len++] = get_escape_char(*p++);
-        } else {
-            buf[len++] = *p++;
-        }
+        p++;
+        ts->strbuf[ts->strbuf_len++] = get_escape_char(*p++);
     }
 
-    Token *tok = new_token(TK_STR, cur, start, p - start + 1);
-    tok->contents = malloc(len + 1);
-    memcpy(tok->contents, buf, len);
-    tok->contents[len] = '\0';
-    tok->cont_len = len + 1;
-    return tok;
+    ts->strbuf[ts->strbuf_len++] = '\0';
+    int id = add_strlit(ts, offset, ts->strbuf_len - offset);
+    add_token(ts, TK_STR, start, p - start + 1, id);
+    return p - start + 1;
 }
 
-// 入力文字列pをトークナイズしてそれを返す
-Token *tokenize() {
-    char *p = user_input;
-    Token head = {};
-    Token *cur = &head;
-
+// Tokenizes [p, end) and appends the tokens to ts. If intern_idents
+// is false, identifiers are left with atom number -1 so that the
+// caller can intern them later on a single thread.
+static void tokenize_range(TokenArray *ts, char *p, char *end, bool intern_idents) {
+    while (p < end) {
+        int cls = char_class[(unsigned char)*p];
 
-    while (*p) {
         // Skip whitespace characters.
-        if (isspace(*p)) {
-            p++;
+        if (cls & C_SPACE) {
+            p = skip_space(p + 1);
+            continue;
+        }
+
+        // Identifier or keyword
+        if (cls & C_ALPHA) {
+            char *q = p;
+            p = skip_ident(p + 1);
+
+            int kw = find_keyword(q, p - q);
+            if (kw >= 0)
+                add_token(ts, TK_RESERVED, q, p - q, kw);
+            else
+                add_token(ts, TK_IDENT, q, p - q, intern_idents ? intern_id(q, p - q) : -1);
+            continue;
+        }
+
+        // Integer literal
+        if (cls & C_DIGIT) {
+            char *q = p;
+            long val = strtol(p, &p, 10);
+            add_token(ts, TK_NUM, q, p - q, val);
             continue;
         }
 
         // line comment
         if (startswith(p, "//")) {
-            p += 2;
-            while (*p != '\n')
-                p++;
+            p = find_byte2(p + 2, '\n', '\n');
             continue;
         }
 
         // Block comment
         if (startswith(p, "/*")) {
-            char *q = strstr(p + 2, "*/");
-            if (!q)
-                error_at(p, "unclosed block comment");
-            p = q + 2;
+            // コメントの中では '*' より '/' の方が珍しいので，'/' を探して
+            // 直前が '*' かどうかを見る．"/*/" は閉じていない
+            char *q = p + 3;
+            for (;; q++) {
+                q = find_byte2(q, '/', '/');
+                if (!*q)
+                    error_at(p, "unclosed block comment");
+                if (q[-1] == '*')
+                    break;
+            }
+            p = q + 1;
             continue;
         }
 
         // String literal
         if (*p == '"') {
-            cur = read_string_literal(cur, p);
-            p += cur->len;
+            p += read_string_literal(ts, p);
             continue;
-
         }
 
-        // Keywords or multi-letter punctuators
-        char *kw = starts_with_reserved(p);
-        if (kw) {
-            int len = strlen(kw);
-            cur = new_token(TK_RESERVED, cur, p, len);
-            p += len;
+        // Punctuators
+        if (cls & C_PUNCT) {
+            p += read_punct(ts, p);
             continue;
         }
 
-        // Identifier
-        if (is_alpha(*p)) {
-            char *q = p++;
-            while (is_alnum(*p)) {
-                p++;
+        error_at(p, "invalid token");
+    }
+}
+
+
+// Finds at most n - 1 places where the input can be cut into chunks of
+// roughly equal size that tokenize to the same tokens as the whole. A
+// cut is always at a newline outside of string literals and comments,
+// so no token spans two chunks. Only quotes and slashes can change the
+// state, so the scan jumps between them with strcspn() and memchr(),
+// which libc implements with vector instructions.
+static int find_splits(char *p, char *end, char **splits, int n) {
+    char *start = p;
+    int nsplits = 0;
+    char *target = start + (end - start) / n;
+
+    while (p < end && nsplits < n - 1) {
+        char *q = p + strcspn(p, "\"/");
+
+        // [p, q) は文字列やコメントの外なので，どの改行でも切れる
+        if (target < q) {
+            char *nl = memchr(target < p ? p : target, '\n', q - (target < p ? p : target));
+            if (nl) {
+                splits[nsplits++] = nl;
+                target = start + (end - start) / n * (nsplits + 1);
+                p = nl + 1;
+                continue;
             }
-            cur = new_token(TK_IDENT, cur, q, p - q);
-            continue;
         }
 
-        // Single-letter punctuators
-        if (ispunct(*p)) {
-            cur = new_token(TK_RESERVED, cur, p++, 1);
-            continue;
+        if (q >= end)
+            break;
+
+        if (*q == '"') {
+            for (q++; q < end && *q != '"'; q++)
+                if (*q == '\\')
+                    q++;
+            p = q + 1;
+        } else if (q[1] == '/') {
+            p = memchr(q, '\n', end - q);
+            if (!p)
+                break;
+        } else if (q[1] == '*') {
+            p = strstr(q + 2, "*/");
+            if (!p)
+                break;
+            p += 2;
+        } else {
+            p = q + 1;
         }
+    }
+    return nsplits;
+}
 
-        // Integer literal
-        if (isdigit(*p)) {
-            cur = new_token(TK_NUM, cur, p, 0);
-            char *q = p;
-            cur->val = strtol(p, &p, 10);
-            cur->len = p - q;
-            continue;
+typedef struct {
+    char *begin;
+    char *end;
+    TokenArray tokens;
+    bool failed;   // 字句解析のエラーがあった
+    CompileContext *ctx;
+} Chunk;
+
+static void *tokenize_chunk(void *arg) {
+    Chunk *c = arg;
+    jmp_buf env;
+
+    ctx = c->ctx;
+    lex_bailout = &env;
+    if (setjmp(env))
+        c->failed = true;
+    else
+        tokenize_range(&c->tokens, c->begin, c->end, false);
+    lex_bailout = NULL;
+    return NULL;
+}
+
+// Frees the arrays of ts and leaves it empty.
+void free_tokens(TokenArray *ts) {
+    free(ts->kind);
+    free(ts->loc);
+    free(ts->len);
+    free(ts->val);
+    free(ts->strs);
+    free(ts->strbuf);
+    *ts = (TokenArray){};
+}
+
+static void free_chunks(Chunk *chunks, int nchunks) {
+    for (int i = 0; i < nchunks; i++)
+        free_tokens(&chunks[i].tokens);
+    free(chunks);
+}
+
+// Appends the tokens of a chunk to ts. Identifiers are interned here,
+// and string literals are moved past the ones already in ts.
+static void append_tokens(TokenArray *ts, TokenArray *c) {
+    int base = ts->nstrs;
+    int offset = ts->strbuf_len;
+    if (c->strbuf_len) {
+        reserve_strbuf(ts, c->strbuf_len);
+        memcpy(ts->strbuf + offset, c->strbuf, c->strbuf_len);
+        ts->strbuf_len += c->strbuf_len;
+    }
+    for (int i = 0; i < c->nstrs; i++)
+        add_strlit(ts, c->strs[i].offset + offset, c->strs[i].len);
+
+    for (int i = 0; i < c->size; i++) {
+        int val = c->val[i];
+        if (c->kind[i] == TK_IDENT)
+            val = intern_id(ctx->user_input + c->loc[i], c->len[i]);
+        else if (c->kind[i] == TK_STR)
+            val += base;
+        add_token(ts, c->kind[i], ctx->user_input + c->loc[i], c->len[i], val);
+    }
+}
+
+// Tokenizes large inputs on ctx->opt_jobs threads. Each chunk gets its own
+// token array, and the arrays are appended in source order, interning
+// identifiers as they go, so the result is identical to the one the
+// sequential loop would make. If a chunk has an error, it is tokenized
+// again on this thread so that the first error in the file is reported,
+// exactly as before.
+static void tokenize_parallel(TokenArray *ts, char *p, char *end, int nchunks) {
+    char **splits = calloc(nchunks, sizeof(char *));
+    nchunks = find_splits(p, end, splits, nchunks) + 1;
+
+    Chunk *chunks = calloc(nchunks, sizeof(Chunk));
+    for (int i = 0; i < nchunks; i++) {
+        chunks[i].begin = i ? splits[i - 1] : p;
+        chunks[i].end = i < nchunks - 1 ? splits[i] : end;
+        chunks[i].ctx = ctx;
+    }
+    free(splits);
+
+    // スレッドを作れなかったチャンクはこのスレッドで読む
+    pthread_t *threads = calloc(nchunks, sizeof(pthread_t));
+    int nthreads = 1;
+    while (nthreads < nchunks && !pthread_create(&threads[nthreads], NULL, tokenize_chunk, &chunks[nthreads]))
+        nthreads++;
+    for (int i = nthreads; i < nchunks; i++)
+        tokenize_chunk(&chunks[i]);
+    tokenize_chunk(&chunks[0]);
+    for (int i = 1; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+
+    // compile() の中でエラーになったら，チャンクを解放してから戻る
+    jmp_buf env;
+    jmp_buf *outer = ctx->bailout;
+    if (outer) {
+        if (setjmp(env)) {
+            free_chunks(chunks, nchunks);
+            ctx->bailout = outer;
+            longjmp(*outer, 1);
         }
+        ctx->bailout = &env;
+    }
 
-        error_at(p, "invalid token");
+    for (int i = 0; i < nchunks; i++) {
+        Chunk *c = &chunks[i];
+        if (c->failed) {
+            tokenize_range(ts, c->begin, c->end, true);
+            unreachable();
+        }
+        append_tokens(ts, &c->tokens);
+        free_tokens(&c->tokens);
     }
-    new_token(TK_EOF, cur, p, 0);
-    return head.next;
+
+    ctx->bailout = outer;
+    free_chunks(chunks, nchunks);
+}
+
+// 入力文字列 ctx->user_input をトークナイズして ctx->tokens に入れ，最初のトークンの
+// 番号を返す
+Token tokenize() {
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, init_tables);
+    intern_fixed_atoms();
+
+    char *p = ctx->user_input;
+    char *end = p + strlen(p);
+    TokenArray *ts = &ctx->tokens;
+
+    // トークンの位置と長さは32ビットで持つ
+    if (end - p > UINT32_MAX)
+        error("%s: input too large (%ld bytes; the limit is 4 GiB)", ctx->filename, (long)(end - p));
+
+    // 番号 0 は「トークンなし」を表すのに使うので，ダミーを置いておく
+    add_token(ts, TK_EOF, p, 0, 0);
+
+    // 入力が1チャンクの最小のバイト数の2倍以上あり，-j が2以上の時に
+    // 並列に字句解析する
+    long nchunks = (end - p) / ctx->lex_chunk_size;
+    if (nchunks > ctx->opt_jobs)
+        nchunks = ctx->opt_jobs;
+
+    if (nchunks >= 2)
+        tokenize_parallel(ts, p, end, nchunks);
+    else
+        tokenize_range(ts, p, end, true);
+    add_token(ts, TK_EOF, end, 0, 0);
+    ctx->counts.tokens = ts->size - 1;
+    return 1;
 }
 
+// Prints the tokens one per line to the current output (see out_open()),
+// for comparing lexers with each other.
+void dump_tokens(Token tok) {
+    static char *kinds[] = {"reserved", "str", "num", "ident", "eof"};
+
+    TokenArray *ts = &ctx->tokens;
+    for (; tok < ts->size; tok++) {
+        int kind = ts->kind[tok];
+        out_int(ts->loc[tok]);
+        out_char(' ');
+        out_int(ts->len[tok]);
+        out_char(' ');
+        out_str(kinds[kind]);
+        if (kind == TK_NUM) {
+            out_char(' ');
+            out_int(ts->val[tok]);
+        }
+        if (kind == TK_IDENT || kind == TK_RESERVED) {
+            out_char(' ');
+            out_str(tok_atom(tok));
+        }
+        if (kind == TK_STR) {
+            out_char(' ');
+            out_int(tok_cont_len(tok));
+            out_str(" \"");
+            out_write(tok_contents(tok), tok_cont_len(tok) - 1);
+            out_char('"');
+        }
+        out_char('\n');
+    }
+}
@@ -7,18 +7,22 @@ bool is_integer(Type *ty) {
     return ty->kind == TY_CHAR || ty->kind == TY_INT;
 }
 
+Type *new_type(TypeKind kind, int size) {
+    Type *ty = arena_alloc(&ctx->type_arena, sizeof(Type));
+    ctx->counts.types++;
+    ty->kind = kind;
+    ty->size = size;
+    return ty;
+}
+
 Type *pointer_to(Type *base) {
-    Type *ty = calloc(1, sizeof(Type));
-    ty->kind = TY_PTR;
-    ty->size = 8;
+    Type *ty = new_type(TY_PTR, 8);
     ty->base = base;
     return ty;
 }
 
 Type *array_of(Type *base, int len) {
-    Type *ty = calloc(1, sizeof(Type));
-    ty->kind = TY_ARRAY;
-    ty->size = base->size * len;
+    Type *ty = new_type(TY_ARRAY, base->size * len);
     ty->base = base;
     ty->array_len = len;
     return ty;
@@ -47,6 +51,7 @@ void add_type(Node *node) {
         case ND_PTR_DIFF:
         case ND_MUL:
         case ND_DIV:
+        case ND_SHL:
         case ND_EQ:
         case ND_NE:
         case ND_LT:
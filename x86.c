@@ -0,0 +1,350 @@
+#include "9cc.h"
+
+// 32bit の相対アドレスを後で埋める必要がある箇所
+typedef struct Fixup Fixup;
+struct Fixup {
+    Fixup *next;
+    int offset;   // rel32 の位置
+    char *name;   // 飛び先のラベル
+    bool is_call;
+};
+
+static MachineCode *mc;
+static HashMap labels;
+static Fixup *fixups;
+
+static void emit8(int b) {
+    if (mc->len == mc->cap) {
+        mc->cap = mc->cap ? mc->cap * 2 : 4096;
+        mc->buf = realloc(mc->buf, mc->cap);
+    }
+    mc->buf[mc->len++] = b;
+}
+
+static void emit32(int v) {
+    for (int i = 0; i < 4; i++)
+        emit8((v >> (i * 8)) & 0xff);
+}
+
+static bool is_int8(long v) {
+    return -128 <= v && v <= 127;
+}
+
+static bool is_int32(long v) {
+    return INT32_MIN <= v && v <= INT32_MAX;
+}
+
+static void add_reloc(RelocKind kind, char *name) {
+    Reloc *rel = calloc(1, sizeof(Reloc));
+    rel->kind = kind;
+    rel->offset = mc->len;
+    rel->name = name;
+    rel->next = mc->relocs;
+    mc->relocs = rel;
+}
+
+// spl, bpl, sil, dil は REX プレフィックスがないと指定できない
+static bool needs_rex8(Operand *opd) {
+    return opd->kind == OPD_REG && opd->size == 1 && RSP <= opd->reg && opd->reg <= RDI;
+}
+
+// Emits [REX] opcode ModRM [SIB] [disp] for an instruction whose ModRM.reg
+// field holds r (a register or an opcode extension) and whose ModRM.r/m
+// field addresses rm.
+static void emit_modrm(bool w, int opcode, int oplen, int r, bool r_rex8, Operand *rm) {
+    int rex = 0x40 | (w << 3) | ((r >> 3) << 2) | (rm->reg >> 3);
+    if (rex != 0x40 || r_rex8 || needs_rex8(rm))
+        emit8(rex);
+
+    for (int i = oplen - 1; i >= 0; i--)
+        emit8((opcode >> (i * 8)) & 0xff);
+
+    int base = rm->reg & 7;
+    if (rm->kind == OPD_REG) {
+        emit8(0xc0 | ((r & 7) << 3) | base);
+        return;
+    }
+
+    assert(rm->kind == OPD_MEM);
+    long disp = rm->imm;
+    int mod = (disp == 0 && base != RBP) ? 0 : is_int8(disp) ? 1 : 2;
+    emit8((mod << 6) | ((r & 7) << 3) | base);
+    if (base == RSP)
+        emit8(0x24);
+    if (mod == 1)
+        emit8(disp);
+    else if (mod == 2)
+        emit32(disp);
+}
+
+// Emits an instruction of the form "op r/m, reg".
+static void emit_rm_reg(int opcode, int oplen, Operand *rm, Operand *r) {
+    emit_modrm(r->size == 8, opcode, oplen, r->reg, needs_rex8(r), rm);
+}
+
+// Emits an instruction of the form "op reg, r/m".
+static void emit_reg_rm(int opcode, int oplen, Operand *r, Operand *rm) {
+    emit_modrm(r->size == 8, opcode, oplen, r->reg, needs_rex8(r), rm);
+}
+
+static void emit_rel32(char *name, bool is_call) {
+    Fixup *fix = calloc(1, sizeof(Fixup));
+    fix->offset = mc->len;
+    fix->name = name;
+    fix->is_call = is_call;
+    fix->next = fixups;
+    fixups = fix;
+    emit32(0);
+}
+
+static void bad_insn(Insn *insn) {
+    error("internal error: cannot encode instruction %d", insn->kind);
+}
+
+// add/sub/and/cmp
+static void encode_alu(Insn *insn, int opcode, int ext) {
+    Operand *dst = &insn->dst;
+    Operand *src = &insn->src;
+
+    if (dst->kind != OPD_REG)
+        bad_insn(insn);
+
+    if (src->kind == OPD_REG) {
+        emit_rm_reg(opcode, 1, dst, src);
+        return;
+    }
+
+    // "op reg, r/m" の形はオペコードの方向ビットを立てたもの
+    if (src->kind == OPD_MEM) {
+        emit_reg_rm(opcode | 2, 1, dst, src);
+        return;
+    }
+
+    if (src->kind == OPD_IMM && is_int8(src->imm)) {
+        emit_modrm(true, 0x83, 1, ext, false, dst);
+        emit8(src->imm);
+        return;
+    }
+
+    if (src->kind == OPD_IMM && is_int32(src->imm)) {
+        emit_modrm(true, 0x81, 1, ext, false, dst);
+        emit32(src->imm);
+        return;
+    }
+
+    bad_insn(insn);
+}
+
+static void encode_mov(Insn *insn) {
+    Operand *dst = &insn->dst;
+    Operand *src = &insn->src;
+
+    if (dst->kind == OPD_REG) {
+        switch (src->kind) {
+            case OPD_REG:
+                emit_rm_reg(0x89, 1, dst, src);
+                return;
+            case OPD_MEM:
+                emit_reg_rm(0x8b, 1, dst, src);
+                return;
+            case OPD_IMM:
+                if (!is_int32(src->imm))
+                    bad_insn(insn);
+                emit_modrm(true, 0xc7, 1, 0, false, dst);
+                emit32(src->imm);
+                return;
+            case OPD_SYM:
+                emit_modrm(true, 0xc7, 1, 0, false, dst);
+                add_reloc(R_ABS32S, src->name);
+                emit32(0);
+                return;
+        }
+    }
+
+    if (dst->kind == OPD_MEM && src->kind == OPD_REG) {
+        emit_rm_reg(src->size == 1 ? 0x88 : 0x89, 1, dst, src);
+        return;
+    }
+
+    bad_insn(insn);
+}
+
+static void encode_insn(Insn *insn) {
+    Operand *dst = &insn->dst;
+    Operand *src = &insn->src;
+
+    switch (insn->kind) {
+        case I_LABEL: {
+            int *offset = malloc(sizeof(int));
+            *offset = mc->len;
+            hashmap_put(&labels, dst->name, offset);
+
+            if (insn->global) {
+                TextSym *sym = calloc(1, sizeof(TextSym));
+                sym->name = dst->name;
+                sym->offset = mc->len;
+                sym->next = mc->syms;
+                mc->syms = sym;
+            }
+            return;
+        }
+        case I_MOV:
+            encode_mov(insn);
+            return;
+        case I_MOVSX:
+            emit_reg_rm(0x0fbe, 2, dst, src);
+            return;
+        case I_MOVZX:
+            emit_reg_rm(0x0fb6, 2, dst, src);
+            return;
+        case I_LEA:
+            emit_reg_rm(0x8d, 1, dst, src);
+            return;
+        case I_PUSH:
+            if (dst->kind == OPD_REG) {
+                if (dst->reg >= R8)
+                    emit8(0x41);
+                emit8(0x50 + (dst->reg & 7));
+            } else if (dst->kind == OPD_IMM && is_int8(dst->imm)) {
+                emit8(0x6a);
+                emit8(dst->imm);
+            } else if (dst->kind == OPD_IMM && is_int32(dst->imm)) {
+                emit8(0x68);
+                emit32(dst->imm);
+            } else if (dst->kind == OPD_SYM) {
+                emit8(0x68);
+                add_reloc(R_ABS32S, dst->name);
+                emit32(0);
+            } else {
+                bad_insn(insn);
+            }
+            return;
+        case I_POP:
+            if (dst->reg >= R8)
+                emit8(0x41);
+            emit8(0x58 + (dst->reg & 7));
+            return;
+        case I_ADD:
+            encode_alu(insn, 0x01, 0);
+            return;
+        case I_SUB:
+            encode_alu(insn, 0x29, 5);
+            return;
+        case I_AND:
+            encode_alu(insn, 0x21, 4);
+            return;
+        case I_CMP:
+            encode_alu(insn, 0x39, 7);
+            return;
+        case I_IMUL:
+            if (src->kind == OPD_REG || src->kind == OPD_MEM) {
+                emit_reg_rm(0x0faf, 2, dst, src);
+            } else if (is_int8(src->imm)) {
+                emit_reg_rm(0x6b, 1, dst, dst);
+                emit8(src->imm);
+            } else {
+                emit_reg_rm(0x69, 1, dst, dst);
+                emit32(src->imm);
+            }
+            return;
+        case I_SHL:
+            if (src->kind == OPD_REG) {
+                assert(src->reg == RCX);
+                emit_modrm(true, 0xd3, 1, 4, false, dst);
+            } else {
+                emit_modrm(true, 0xc1, 1, 4, false, dst);
+                emit8(src->imm);
+            }
+            return;
+        case I_CQO:
+            emit8(0x48);
+            emit8(0x99);
+            return;
+        case I_IDIV:
+            emit_modrm(true, 0xf7, 1, 7, false, dst);
+            return;
+        case I_SET:
+            emit_modrm(false, 0x0f90 + insn->cc, 2, 0, false, dst);
+            return;
+        case I_JMP:
+            emit8(0xe9);
+            emit_rel32(dst->name, false);
+            return;
+        case I_JCC:
+            emit8(0x0f);
+            emit8(0x80 + insn->cc);
+            emit_rel32(dst->name, false);
+            return;
+        case I_CALL:
+            emit8(0xe8);
+            emit_rel32(dst->name, true);
+            return;
+        case I_RET:
+            emit8(0xc3);
+            return;
+    }
+
+    bad_insn(insn);
+}
+
+// Patches jumps and calls whose target is defined in this code. Calls
+// to other symbols are left as relocations.
+static void resolve_fixups() {
+    for (Fixup *fix = fixups; fix; fix = fix->next) {
+        int *target = hashmap_get(&labels, fix->name);
+        if (!target) {
+            if (!fix->is_call)
+                error("internal error: undefined label %s", fix->name);
+            Reloc *rel = calloc(1, sizeof(Reloc));
+            rel->kind = R_PC32;
+            rel->offset = fix->offset;
+            rel->name = fix->name;
+            rel->next = mc->relocs;
+            mc->relocs = rel;
+            continue;
+        }
+
+        int rel = *target - (fix->offset + 4);
+        memcpy(mc->buf + fix->offset, &rel, 4);
+    }
+}
+
+// Encodes the instructions into x86-64 machine code.
+MachineCode *encode(Insn *insns) {
+    mc = calloc(1, sizeof(MachineCode));
+    labels = (HashMap){};
+    fixups = NULL;
+
+    for (Insn *insn = insns; insn; insn = insn->next)
+        encode_insn(insn);
+    resolve_fixups();
+
+    // 関数の大きさは次の関数の先頭までとする
+    int end = mc->len;
+    for (TextSym *sym = mc->syms; sym; sym = sym->next) {
+        sym->size = end - sym->offset;
+        end = sym->offset;
+    }
+    return mc;
+}
+
+// Lays out global variables in .data in the same order emit_asm() prints
+// them. Each Var's offset is set to its position in the section and the
+// Var is registered in vars by name. Returns the section contents.
+unsigned char *layout_data(Program *prog, int *size, HashMap *vars) {
+    int len = 0;
+    for (VarList *vl = prog->globals; vl; vl = vl->next) {
+        Var *var = vl->var;
+        var->offset = len;
+        len += var->ty->size;
+        hashmap_put(vars, var->name, var);
+    }
+
+    unsigned char *buf = calloc(1, len ? len : 1);
+    for (VarList *vl = prog->globals; vl; vl = vl->next)
+        if (vl->var->contents)
+            memcpy(buf + vl->var->offset, vl->var->contents, vl->var->cont_len);
+
+    *size = len;
+    return buf;
+}